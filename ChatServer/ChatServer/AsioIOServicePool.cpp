@@ -1,5 +1,11 @@
 #include "AsioIOServicePool.h"
+#include "ConfigMgr.h"
 #include <iostream>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 AsioIOServicePool::~AsioIOServicePool()
 {
 	Stop();
@@ -8,11 +14,24 @@ AsioIOServicePool::~AsioIOServicePool()
 
 boost::asio::io_context& AsioIOServicePool::GetIOService()
 {
-	auto& service = _ioServices[_nextIOService++];// TODO: ڴ˴ return 
-	if (_nextIOService == _ioServices.size()) {
-		_nextIOService = 0;
-	}
-	return service;
+	return _ioServices[NextIndex()];
+}
+
+std::size_t AsioIOServicePool::NextIndex()
+{
+	//߳ͬʱʱҲܰȫѯ
+	std::size_t index = _nextIOService.fetch_add(1, std::memory_order_relaxed);
+	return index % _ioServices.size();
+}
+
+boost::asio::io_context& AsioIOServicePool::GetIOService(std::size_t index)
+{
+	return _ioServices[index % _ioServices.size()];
+}
+
+std::size_t AsioIOServicePool::Size()
+{
+	return _ioServices.size();
 }
 
 void AsioIOServicePool::Stop()
@@ -20,23 +39,65 @@ void AsioIOServicePool::Stop()
 	//Ϊִwork.resetiocontextrun״̬˳
 	//iocontextѾ˶дļ¼󣬻Ҫֶstop÷
 	for (auto& work : _works) {
+		if (work == nullptr) {
+			continue;
+		}
 		work->get_executor().context().stop();
 		work.reset();
 	}
 	for (auto& t : _threads) {
-		t.join();
+		if (t.joinable()) {
+			t.join();
+		}
 	}
 }
 
-AsioIOServicePool::AsioIOServicePool(std::size_t size) :_ioServices(size), _works(size), _nextIOService(0) {
+AsioIOServicePool::AsioIOServicePool() :_nextIOService(0) {
+	auto& cfg = ConfigMgr::Inst();
+	std::size_t size = 0;
+	auto num_str = cfg["IOServicePool"]["ThreadNum"];
+	if (!num_str.empty()) {
+		size = std::stoul(num_str);
+	}
+	if (size == 0) {
+		size = std::thread::hardware_concurrency();
+	}
+	if (size == 0) {
+		size = 1;
+	}
+	bool b_pin = cfg["IOServicePool"]["PinCpu"] == "true";
+
+	_ioServices = std::vector<IOService>(size);
+	_works.resize(size);
 	for (std::size_t i = 0; i < size; ++i) {
 		_works[i] = std::make_unique<Work>(_ioServices[i].get_executor());
 	}
 	//ioservicẹ߳ÿ߳ڲioservice
+	std::size_t cpu_num = std::thread::hardware_concurrency();
 	for (std::size_t i = 0; i < size; ++i) {
 		_threads.emplace_back([this, i]() {
 			_ioServices[i].run();
-			});		
+			});
+		//ÿ̶̹߳һУ߳ǨƴĻʧЧ
+		if (b_pin && cpu_num > 0) {
+			BindCpu(_threads.back(), i % cpu_num);
+		}
 	}
+	std::cout << "AsioIOServicePool start " << size << " threads" << std::endl;
 }
 
+void AsioIOServicePool::BindCpu(std::thread& thread, std::size_t cpu)
+{
+#ifdef _WIN32
+	if (SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1) << cpu) == 0) {
+		std::cout << "bind io thread to cpu " << cpu << " failed" << std::endl;
+	}
+#elif defined(__linux__)
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	CPU_SET(cpu, &cpu_set);
+	if (pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpu_set) != 0) {
+		std::cout << "bind io thread to cpu " << cpu << " failed" << std::endl;
+	}
+#endif
+}
@@ -0,0 +1,483 @@
+#include "AsyncRedis.h"
+#include "AsioIOServicePool.h"
+#include "ConfigMgr.h"
+#include <cstring>
+
+namespace {
+	const int RETRY_MIN_MS = 100;
+	const int RETRY_MAX_MS = 5000;
+	//ڼ໺ֱֽʧܻص
+	const std::size_t MAX_PENDING_BYTES = 16 * 1024 * 1024;
+	const std::size_t READ_CHUNK = 16 * 1024;
+
+	RedisResult MakeError(const std::string& reason) {
+		RedisResult result;
+		result.type = RESULT_ERROR;
+		result.str = reason;
+		return result;
+	}
+
+	//\r\n\rλãҲnpos
+	std::size_t FindCRLF(const char* data, std::size_t len, std::size_t pos) {
+		for (std::size_t i = pos; i + 1 < len; ++i) {
+			if (data[i] == '\r' && data[i + 1] == '\n') {
+				return i;
+			}
+		}
+		return std::string::npos;
+	}
+
+	bool ParseInteger(const char* begin, const char* end, long long& value) {
+		if (begin == end) {
+			return false;
+		}
+		bool negative = false;
+		if (*begin == '-') {
+			negative = true;
+			++begin;
+		}
+		if (begin == end) {
+			return false;
+		}
+		long long v = 0;
+		for (; begin != end; ++begin) {
+			if (*begin < '0' || *begin > '9') {
+				return false;
+			}
+			v = v * 10 + (*begin - '0');
+		}
+		value = negative ? -v : v;
+		return true;
+	}
+}
+
+AsyncRedisConn::AsyncRedisConn(boost::asio::io_context& io_context, const std::string& host,
+	const std::string& port, const std::string& pwd)
+	:_io_context(io_context), _socket(io_context), _resolver(io_context), _retry_timer(io_context),
+	_host(host), _port(port), _pwd(pwd), _retry_delay_ms(RETRY_MIN_MS), _b_stop(false),
+	_b_connected(false), _b_retry_wait(false), _b_writing(false), _read_buf(READ_CHUNK), _read_begin(0), _read_end(0),
+	_b_flush_posted(false)
+{
+}
+
+AsyncRedisConn::~AsyncRedisConn()
+{
+}
+
+void AsyncRedisConn::Start()
+{
+	auto self = shared_from_this();
+	boost::asio::post(_io_context, [self]() {
+		self->Connect();
+		});
+}
+
+void AsyncRedisConn::Stop()
+{
+	_b_stop = true;
+	auto self = shared_from_this();
+	boost::asio::post(_io_context, [self]() {
+		boost::system::error_code ec;
+		self->_retry_timer.cancel();
+		self->_socket.close(ec);
+		});
+}
+
+void AsyncRedisConn::Command(std::string&& request, RedisCallback&& callback)
+{
+	bool need_post = false;
+	bool overflow = false;
+	{
+		std::lock_guard<std::mutex> lock(_pending_mtx);
+		if (_pending.size() + request.size() > MAX_PENDING_BYTES) {
+			overflow = true;
+		}
+		else {
+			_pending.append(request);
+			_pending_callbacks.emplace_back(std::move(callback));
+			if (!_b_flush_posted) {
+				_b_flush_posted = true;
+				need_post = true;
+			}
+		}
+	}
+
+	if (overflow) {
+		if (callback) {
+			auto result = MakeError("async redis pending overflow");
+			result.b_not_sent = true;
+			callback(result);
+		}
+		return;
+	}
+
+	//ֻڶɿձΪǿʱͶһΣio߳һȡ
+	if (need_post) {
+		auto self = shared_from_this();
+		boost::asio::post(_io_context, [self]() {
+			self->FlushPending();
+			});
+	}
+}
+
+void AsyncRedisConn::AddInitCommand(std::string&& request)
+{
+	_init_cmds.emplace_back(std::move(request));
+}
+
+void AsyncRedisConn::SetPushHandler(RedisCallback handler)
+{
+	_push_handler = std::move(handler);
+}
+
+void AsyncRedisConn::Connect()
+{
+	if (_b_stop) {
+		return;
+	}
+	auto self = shared_from_this();
+	_resolver.async_resolve(_host, _port, [self](const boost::system::error_code& error,
+		tcp::resolver::results_type results) {
+			if (error) {
+				self->HandleError("resolve failed: " + error.message());
+				return;
+			}
+			boost::asio::async_connect(self->_socket, results,
+				[self](const boost::system::error_code& error, const tcp::endpoint&) {
+					self->HandleConnect(error);
+				});
+		});
+}
+
+void AsyncRedisConn::HandleConnect(const boost::system::error_code& error)
+{
+	if (error) {
+		HandleError("connect failed: " + error.message());
+		return;
+	}
+
+	boost::system::error_code ec;
+	_socket.set_option(tcp::no_delay(true), ec);
+	_b_connected = true;
+	_retry_delay_ms = RETRY_MIN_MS;
+	_read_begin = 0;
+	_read_end = 0;
+	std::cout << "async redis connected to " << _host << ":" << _port << std::endl;
+
+	//֤ͳʼл֮ǰʱ_writing_wait_callbacksѾ
+	if (!_pwd.empty()) {
+		AsyncRedis::EncodeCommand({ "AUTH", _pwd }, _writing);
+		_wait_callbacks.emplace_back([](const RedisResult& result) {
+			if (result.IsError()) {
+				std::cout << "async redis auth failed: " << result.str << std::endl;
+			}
+			});
+	}
+	for (auto& cmd : _init_cmds) {
+		_writing.append(cmd);
+		_wait_callbacks.emplace_back(nullptr);
+	}
+	DoRead();
+	FlushPending();
+}
+
+void AsyncRedisConn::FlushPending()
+{
+	{
+		std::lock_guard<std::mutex> lock(_pending_mtx);
+		_b_flush_posted = false;
+		if (!_b_connected) {
+			//δʱ_pendingУϺٷ
+			return;
+		}
+		_writing.append(_pending);
+		_pending.clear();
+		for (auto& callback : _pending_callbacks) {
+			_wait_callbacks.emplace_back(std::move(callback));
+		}
+		_pending_callbacks.clear();
+	}
+	DoWrite();
+}
+
+void AsyncRedisConn::DoWrite()
+{
+	if (_b_writing || _writing.empty() || !_b_connected) {
+		return;
+	}
+	_b_writing = true;
+	auto data = std::make_shared<std::string>();
+	data->swap(_writing);
+	auto self = shared_from_this();
+	boost::asio::async_write(_socket, boost::asio::buffer(*data),
+		[self, data](const boost::system::error_code& error, std::size_t) {
+			self->_b_writing = false;
+			if (error) {
+				self->HandleError("write failed: " + error.message());
+				return;
+			}
+			self->DoWrite();
+		});
+}
+
+void AsyncRedisConn::DoRead()
+{
+	if (_read_end == _read_buf.size()) {
+		if (_read_begin > 0) {
+			std::memmove(_read_buf.data(), _read_buf.data() + _read_begin, _read_end - _read_begin);
+			_read_end -= _read_begin;
+			_read_begin = 0;
+		}
+		else {
+			_read_buf.resize(_read_buf.size() * 2);
+		}
+	}
+	auto self = shared_from_this();
+	_socket.async_read_some(boost::asio::buffer(_read_buf.data() + _read_end, _read_buf.size() - _read_end),
+		[self](const boost::system::error_code& error, std::size_t bytes_transferred) {
+			self->HandleRead(error, bytes_transferred);
+		});
+}
+
+void AsyncRedisConn::HandleRead(const boost::system::error_code& error, std::size_t bytes_transferred)
+{
+	if (error) {
+		HandleError("read failed: " + error.message());
+		return;
+	}
+
+	_read_end += bytes_transferred;
+	while (_read_begin < _read_end) {
+		RedisResult result;
+		std::size_t pos = _read_begin;
+		int ret = AsyncRedis::ParseResult(_read_buf.data(), _read_end, pos, result);
+		if (ret == 0) {
+			break;
+		}
+		if (ret < 0) {
+			HandleError("protocol error");
+			return;
+		}
+		_read_begin = pos;
+		//͵ϢӦκ
+		if (_push_handler && result.type == RESULT_ARRAY && !result.elements.empty()
+			&& (result.elements[0].str == "message" || result.elements[0].str == "pmessage")) {
+			_push_handler(result);
+			continue;
+		}
+		if (_wait_callbacks.empty()) {
+			HandleError("unexpected reply");
+			return;
+		}
+		auto callback = std::move(_wait_callbacks.front());
+		_wait_callbacks.pop_front();
+		if (callback) {
+			callback(result);
+		}
+	}
+
+	if (_read_begin == _read_end) {
+		_read_begin = 0;
+		_read_end = 0;
+	}
+	DoRead();
+}
+
+void AsyncRedisConn::HandleError(const std::string& reason)
+{
+	//дصȺ󱨴Ѿڵȴʱٴ
+	if (_b_retry_wait) {
+		return;
+	}
+	//رĶдȡӡ
+	if (!_b_stop) {
+		std::cout << "async redis " << reason << std::endl;
+	}
+	_b_connected = false;
+	boost::system::error_code ec;
+	_socket.close(ec);
+	_writing.clear();
+	_read_begin = 0;
+	_read_end = 0;
+
+	//Ѿ֪ǷִУֱʧ
+	auto callbacks = std::move(_wait_callbacks);
+	_wait_callbacks.clear();
+	auto result = MakeError(reason);
+	for (auto& callback : callbacks) {
+		if (callback) {
+			callback(result);
+		}
+	}
+
+	if (_b_stop) {
+		return;
+	}
+	_b_retry_wait = true;
+	_retry_timer.expires_after(std::chrono::milliseconds(_retry_delay_ms));
+	_retry_delay_ms = std::min(_retry_delay_ms * 2, RETRY_MAX_MS);
+	auto self = shared_from_this();
+	_retry_timer.async_wait([self](const boost::system::error_code& error) {
+		self->_b_retry_wait = false;
+		if (error) {
+			return;
+		}
+		self->Connect();
+		});
+}
+
+AsyncRedis::AsyncRedis()
+{
+	auto& cfg = ConfigMgr::Inst();
+	auto pwd = cfg["Redis"]["pwd"];
+	auto num_str = cfg["Redis"]["AsyncConnNum"];
+	_conn_num = num_str.empty() ? 2 : std::stoul(num_str);
+	if (_conn_num == 0) {
+		_conn_num = 1;
+	}
+
+	auto pool = AsioIOServicePool::GetInstance();
+	auto addrs = RedisMgr::LoadAddrs();
+	for (std::size_t shard = 0; shard < addrs.size(); ++shard) {
+		auto& addr = addrs[shard];
+		_ring.AddNode(shard, addr.host + ":" + std::to_string(addr.port));
+		for (std::size_t i = 0; i < _conn_num; ++i) {
+			auto conn = std::make_shared<AsyncRedisConn>(pool->GetIOService(_conns.size()),
+				addr.host, std::to_string(addr.port), pwd);
+			conn->Start();
+			_conns.push_back(conn);
+		}
+	}
+}
+
+AsyncRedis::~AsyncRedis()
+{
+	std::cout << "AsyncRedis destruct" << std::endl;
+}
+
+void AsyncRedis::Command(const std::vector<std::string>& args, RedisCallback callback)
+{
+	//Ȱkeyѡʵʵаkeyѡͬһkeyϵ˳
+	std::size_t shard = 0;
+	if (args.size() > 1) {
+		shard = _ring.GetNode(args[1]);
+	}
+	CommandOnShard(shard, args, std::move(callback));
+}
+
+void AsyncRedis::CommandOnShard(std::size_t shard, const std::vector<std::string>& args, RedisCallback callback)
+{
+	if (args.empty() || shard * _conn_num >= _conns.size()) {
+		if (callback) {
+			auto result = MakeError("async redis no connection");
+			result.b_not_sent = true;
+			callback(result);
+		}
+		return;
+	}
+	std::string request;
+	EncodeCommand(args, request);
+	std::size_t index = shard * _conn_num;
+	if (args.size() > 1) {
+		index += std::hash<std::string>()(args[1]) % _conn_num;
+	}
+	_conns[index]->Command(std::move(request), std::move(callback));
+}
+
+std::future<RedisResult> AsyncRedis::CommandFuture(const std::vector<std::string>& args)
+{
+	auto promise = std::make_shared<std::promise<RedisResult>>();
+	auto future = promise->get_future();
+	Command(args, [promise](const RedisResult& result) {
+		promise->set_value(result);
+		});
+	return future;
+}
+
+void AsyncRedis::Close()
+{
+	for (auto& conn : _conns) {
+		conn->Stop();
+	}
+}
+
+void AsyncRedis::EncodeCommand(const std::vector<std::string>& args, std::string& out)
+{
+	out.append("*").append(std::to_string(args.size())).append("\r\n");
+	for (auto& arg : args) {
+		out.append("$").append(std::to_string(arg.size())).append("\r\n");
+		out.append(arg).append("\r\n");
+	}
+}
+
+int AsyncRedis::ParseResult(const char* data, std::size_t len, std::size_t& pos, RedisResult& result)
+{
+	if (pos >= len) {
+		return 0;
+	}
+	std::size_t line_end = FindCRLF(data, len, pos + 1);
+	if (line_end == std::string::npos) {
+		return 0;
+	}
+	const char* line = data + pos + 1;
+	const char* line_stop = data + line_end;
+	std::size_t next = line_end + 2;
+
+	switch (data[pos]) {
+	case '+':
+	case '-':
+		result.type = data[pos] == '+' ? RESULT_STATUS : RESULT_ERROR;
+		result.str.assign(line, line_stop);
+		pos = next;
+		return 1;
+	case ':':
+		result.type = RESULT_INTEGER;
+		if (!ParseInteger(line, line_stop, result.integer)) {
+			return -1;
+		}
+		pos = next;
+		return 1;
+	case '$': {
+		long long str_len = 0;
+		if (!ParseInteger(line, line_stop, str_len)) {
+			return -1;
+		}
+		if (str_len < 0) {
+			result.type = RESULT_NIL;
+			pos = next;
+			return 1;
+		}
+		if (next + str_len + 2 > len) {
+			return 0;
+		}
+		result.type = RESULT_STRING;
+		result.str.assign(data + next, (std::size_t)str_len);
+		pos = next + str_len + 2;
+		return 1;
+	}
+	case '*': {
+		long long count = 0;
+		if (!ParseInteger(line, line_stop, count)) {
+			return -1;
+		}
+		if (count < 0) {
+			result.type = RESULT_NIL;
+			pos = next;
+			return 1;
+		}
+		result.type = RESULT_ARRAY;
+		result.elements.resize((std::size_t)count);
+		std::size_t cur = next;
+		for (auto& element : result.elements) {
+			int ret = ParseResult(data, len, cur, element);
+			if (ret <= 0) {
+				return ret;
+			}
+		}
+		pos = cur;
+		return 1;
+	}
+	default:
+		return -1;
+	}
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "const.h"
+#include "singleton.h"
+#include "RedisMgr.h"
+#include <deque>
+#include <future>
+#include <mutex>
+#include <vector>
+
+enum RedisResultType {
+	RESULT_NIL = 0,
+	RESULT_STATUS = 1,
+	RESULT_ERROR = 2,
+	RESULT_INTEGER = 3,
+	RESULT_STRING = 4,
+	RESULT_ARRAY = 5,
+};
+
+//redisظRESPЭֱӽõ
+struct RedisResult {
+	RedisResult() :type(RESULT_NIL), b_not_sent(false), integer(0) {}
+	bool IsError() const { return type == RESULT_ERROR; }
+	bool IsNil() const { return type == RESULT_NIL; }
+	RedisResultType type;
+	//ûдʧˣredisһûִУ÷Է
+	bool b_not_sent;
+	//STATUSERRORSTRING͵
+	std::string str;
+	long long integer;
+	std::vector<RedisResult> elements;
+};
+
+//صioִ߳УҪڻص
+typedef std::function<void(const RedisResult&)> RedisCallback;
+
+//һredis첽ӣһio_context
+//˳ˮдظ˳صһһӦߺʧѷ˱ʱ
+class AsyncRedisConn :public std::enable_shared_from_this<AsyncRedisConn>
+{
+public:
+	AsyncRedisConn(boost::asio::io_context& io_context, const std::string& host,
+		const std::string& port, const std::string& pwd);
+	~AsyncRedisConn();
+	void Start();
+	void Stop();
+	//̶߳ԵãrequestΪõRESP
+	void Command(std::string&& request, RedisCallback&& callback);
+	//ÿϺAUTH֮͵SUBSCRIBEStart֮ǰ
+	void AddInitCommand(std::string&& request);
+	//ģʽ·͵messagepmessagehandlerStart֮ǰ
+	void SetPushHandler(RedisCallback handler);
+private:
+	void Connect();
+	void HandleConnect(const boost::system::error_code& error);
+	void FlushPending();
+	void DoWrite();
+	void DoRead();
+	void HandleRead(const boost::system::error_code& error, std::size_t bytes_transferred);
+	void HandleError(const std::string& reason);
+	boost::asio::io_context& _io_context;
+	tcp::socket _socket;
+	tcp::resolver _resolver;
+	boost::asio::steady_timer _retry_timer;
+	std::string _host;
+	std::string _port;
+	std::string _pwd;
+	std::vector<std::string> _init_cmds;
+	RedisCallback _push_handler;
+	int _retry_delay_ms;
+	std::atomic<bool> _b_stop;
+	//³Աֻio߳з
+	bool _b_connected;
+	bool _b_retry_wait;
+	bool _b_writing;
+	std::string _writing;
+	std::deque<RedisCallback> _wait_callbacks;
+	std::vector<char> _read_buf;
+	std::size_t _read_begin;
+	std::size_t _read_end;
+	//߳Ͷݵio߳ȡд
+	std::mutex _pending_mtx;
+	std::string _pending;
+	std::vector<RedisCallback> _pending_callbacks;
+	bool _b_flush_posted;
+};
+
+//asio첽redisͻˣԼRESPЭ飬ռ߼̵߳ȴ
+//RedisMgrͬĹ·ɵredisʵͬһkeyͬһӣ֤Ⱥ˳
+class AsyncRedis :public Singleton<AsyncRedis>
+{
+	friend class Singleton<AsyncRedis>;
+public:
+	~AsyncRedis();
+	//args[0]Ϊargs[1]ͨΪkeycallbackΪ
+	void Command(const std::vector<std::string>& args, RedisCallback callback = nullptr);
+	std::future<RedisResult> CommandFuture(const std::vector<std::string>& args);
+	//key·ɣֱӷshardʵPUBLISHҪͶͬһʵ
+	void CommandOnShard(std::size_t shard, const std::vector<std::string>& args, RedisCallback callback = nullptr);
+	void Close();
+	//ΪRESP
+	static void EncodeCommand(const std::vector<std::string>& args, std::string& out);
+	//data[pos]ʼһظɹ1ƶposݲ0ʽ󷵻-1
+	static int ParseResult(const char* data, std::size_t len, std::size_t& pos, RedisResult& result);
+private:
+	AsyncRedis();
+	//iʵΪ_conns[i * _conn_num]_conns[(i + 1) * _conn_num - 1]
+	std::vector<std::shared_ptr<AsyncRedisConn>> _conns;
+	std::size_t _conn_num;
+	RedisRing _ring;
+};
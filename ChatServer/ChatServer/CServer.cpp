@@ -2,11 +2,58 @@
 #include <iostream>
 #include"AsioIOServicePool.h"
 #include "UserMgr.h"
+#include "ConfigMgr.h"
+#include "OnlineCounter.h"
 CServer::CServer(boost::asio::io_context& io_context, short port)
-	:_io_context(io_context), _port(port), _acceptor(io_context, tcp::endpoint(tcp::v4(), port))
+	:_io_context(io_context), _port(port), _b_reuse_port(false)
 {
-	std::cout << "Server start success, listen on port : " << _port << std::endl;
-	StartAccept();
+	auto& cfg = ConfigMgr::Inst();
+#ifdef SO_REUSEPORT
+	_b_reuse_port = cfg["IOServicePool"]["ReusePort"] == "true";
+#endif
+	//ʱΪ0ʱлỰ
+	int heartbeat_timeout = HEARTBEAT_TIMEOUT;
+	auto timeout_str = cfg["Session"]["HeartbeatTimeout"];
+	if (!timeout_str.empty()) {
+		heartbeat_timeout = std::stoi(timeout_str);
+	}
+	if (heartbeat_timeout > 0) {
+		auto pool = AsioIOServicePool::GetInstance();
+		for (std::size_t i = 0; i < pool->Size(); ++i) {
+			_wheels.emplace_back(new TimerWheel(pool->GetIOService(i), heartbeat_timeout));
+			auto wheel = _wheels.back().get();
+			boost::asio::post(pool->GetIOService(i), [wheel]() {
+				wheel->Start();
+				});
+		}
+	}
+
+	if (!_b_reuse_port) {
+		_acceptors.emplace_back(new tcp::acceptor(io_context, tcp::endpoint(tcp::v4(), port)));
+		std::cout << "Server start success, listen on port : " << _port << std::endl;
+		StartAccept(0);
+		return;
+	}
+
+#ifdef SO_REUSEPORT
+	typedef boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port;
+	auto pool = AsioIOServicePool::GetInstance();
+	tcp::endpoint endpoint(tcp::v4(), port);
+	for (std::size_t i = 0; i < pool->Size(); ++i) {
+		std::unique_ptr<tcp::acceptor> acceptor(new tcp::acceptor(pool->GetIOService(i)));
+		acceptor->open(endpoint.protocol());
+		acceptor->set_option(tcp::acceptor::reuse_address(true));
+		acceptor->set_option(reuse_port(true));
+		acceptor->bind(endpoint);
+		acceptor->listen();
+		_acceptors.push_back(std::move(acceptor));
+	}
+	std::cout << "Server start success, listen on port : " << _port
+		<< " with " << _acceptors.size() << " reuseport acceptors" << std::endl;
+	for (std::size_t i = 0; i < _acceptors.size(); ++i) {
+		StartAccept(i);
+	}
+#endif
 }
 
 CServer::~CServer()
@@ -14,36 +61,81 @@ CServer::~CServer()
 	cout << "Server destruct listen on port : " << _port << endl;
 }
 
-void CServer::ClearSession(std::string session_id)
+void CServer::ClearSession(uint64_t session_id)
 {
-	lock_guard<mutex> lock(_mutex);
-	if (_session.find(session_id) != _session.end()) {
-		auto uid = _session[session_id]->GetUserId();
+	std::shared_ptr<CSession> session;
+	if (!_session.Erase(session_id, &session)) {
+		return;
+	}
+
+	auto drop_count = session->GetSendDropCount();
+	if (drop_count > 0) {
+		std::cout << "session: " << session_id << " closed, send drop count is " << drop_count << std::endl;
+	}
 
-		//ƳûsessionĹ
-		UserMgr::GetInstance()->RmvUserSession(uid, session_id);
+	//¼ĻỰۼ
+	if (session->MarkLogout()) {
+		OnlineCounter::GetInstance()->Decr();
 	}
 
-	_session.erase(session_id);
+	//ƳûsessionĹ
+	UserMgr::GetInstance()->RmvUserSession(session->GetUserId(), session_id);
+}
+
+int64_t CServer::GetMaxSendQueBytes()
+{
+	std::size_t max_bytes = 0;
+	_session.ForEach([&max_bytes](uint64_t, const std::shared_ptr<CSession>& session) {
+		max_bytes = (std::max)(max_bytes, session->GetSendQueBytes());
+		});
+	return max_bytes;
+}
 
+int64_t CServer::GetMaxSendDrop()
+{
+	int64_t max_drop = 0;
+	_session.ForEach([&max_drop](uint64_t, const std::shared_ptr<CSession>& session) {
+		max_drop = (std::max)(max_drop, session->GetSendDropCount());
+		});
+	return max_drop;
+}
+
+int64_t CServer::GetOverWaterCount()
+{
+	int64_t count = 0;
+	_session.ForEach([&count](uint64_t, const std::shared_ptr<CSession>& session) {
+		if (session->IsOverWater()) {
+			++count;
+		}
+		});
+	return count;
 }
 
-void CServer::HandleAccept(std::shared_ptr<CSession> new_session, const boost::system::error_code& error)
+void CServer::HandleAccept(std::size_t index, std::size_t io_index, std::shared_ptr<CSession> new_session, const boost::system::error_code& error)
 {
 	if (!error) {
 		new_session->Start();
-		std::lock_guard<std::mutex> lock(_mutex);
-		_session.insert(make_pair(new_session->GetSessionId(), new_session));
+		if (!_wheels.empty()) {
+			//ʱֻio߳в
+			auto wheel = _wheels[io_index].get();
+			boost::asio::post(AsioIOServicePool::GetInstance()->GetIOService(io_index), [wheel, new_session]() {
+				wheel->AddSession(new_session);
+				});
+		}
+		_session.Set(new_session->GetSessionId(), new_session);
 	}
 	else {
 		std::cout << "session accept failed, error is " << error.what() << std::endl;
 	}
-	StartAccept();
+	StartAccept(index);
 }
 
-void CServer::StartAccept()
+void CServer::StartAccept(std::size_t index)
 {
-	auto& io_context = AsioIOServicePool::GetInstance()->GetIOService();
-	std::shared_ptr<CSession> new_session = std::make_shared<CSession>(io_context, this);
-	_acceptor.async_accept(new_session->GetSocket(), std::bind(&CServer::HandleAccept, this, new_session, placeholders::_1));
+	auto pool = AsioIOServicePool::GetInstance();
+	//reuseportģʽ»Ựacceptorͬһiọ߳߳Ͷ
+	std::size_t io_index = _b_reuse_port ? index : pool->NextIndex();
+	std::shared_ptr<CSession> new_session = std::make_shared<CSession>(pool->GetIOService(io_index), this);
+	_acceptors[index]->async_accept(new_session->GetSocket(),
+		std::bind(&CServer::HandleAccept, this, index, io_index, new_session, placeholders::_1));
 }
@@ -1,23 +1,37 @@
 #pragma once
 #include <boost/asio.hpp>
 #include "CSession.h"
+#include "TimerWheel.h"
+#include "ShardedMap.h"
 #include <memory.h>
 #include <map>
 #include <mutex>
+#include <vector>
 using boost::asio::ip::tcp;
 class CServer
 {
 public:
 	CServer(boost::asio::io_context& io_context, short _port);
 	~CServer();
-	void ClearSession(std::string);
+	void ClearSession(uint64_t session_id);
+	//лỰзͶлѹֽ
+	int64_t GetMaxSendQueBytes();
+	//ỰۼƶϢֵ
+	int64_t GetMaxSendDrop();
+	//Ͷдڸˮλ״̬ĻỰ
+	int64_t GetOverWaterCount();
 private:
-	void HandleAccept(std::shared_ptr<CSession>, const boost::system::error_code& error);
-	void StartAccept();
+	void HandleAccept(std::size_t index, std::size_t io_index, std::shared_ptr<CSession>, const boost::system::error_code& error);
+	void StartAccept(std::size_t index);
 	boost::asio::io_context& _io_context;
 	short _port;
-	tcp::acceptor _acceptor;
-	std::map<std::string, std::shared_ptr<CSession>> _session;
-	std::mutex _mutex;
+	//ģʽֻһacceptorѯָiọ߳
+	//reuseportģʽÿio߳һacceptorں˷ӣỰڽ߳
+	std::vector<std::unique_ptr<tcp::acceptor>> _acceptors;
+	bool _b_reuse_port;
+	//ÿio߳һʱ֣߳ϵĿлỰ
+	std::vector<std::unique_ptr<TimerWheel>> _wheels;
+	//ỰֶμӡϿͲֻڵĶ
+	ShardedMap<uint64_t, std::shared_ptr<CSession>> _session;
 };
 
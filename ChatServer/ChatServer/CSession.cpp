@@ -1,16 +1,136 @@
 #include "CSession.h"
 #include "CServer.h"
 #include "LogicSystem.h"
+#include "ConfigMgr.h"
+#include "RedisMgr.h"
+#include "MsgCodec.h"
+#include "MsgCompress.h"
+#include "AsyncRedis.h"
+#include <random>
+
+namespace {
+	//ͶˮλѲԣõ[Session]ڶȡһ
+	struct SendQueConfig {
+		std::size_t high_water;
+		std::size_t low_water;
+		SendSlowPolicy policy;
+		std::size_t compress_threshold;
+		//߶бʹʱ()
+		int64_t spill_max_len;
+		int64_t spill_ttl;
+		SendQueConfig() :high_water(SEND_HIGH_WATER), low_water(SEND_LOW_WATER), policy(SLOW_DROP_OLDEST),
+			compress_threshold(COMPRESS_THRESHOLD), spill_max_len(OFFLINE_MSG_MAX_LEN), spill_ttl(OFFLINE_MSG_TTL) {
+			auto& cfg = ConfigMgr::Inst();
+			auto spill_len_str = cfg["Session"]["SpillMaxLen"];
+			if (!spill_len_str.empty()) {
+				spill_max_len = (std::max)(1LL, std::stoll(spill_len_str));
+			}
+			auto spill_ttl_str = cfg["Session"]["SpillTTL"];
+			if (!spill_ttl_str.empty()) {
+				spill_ttl = (std::max)(1LL, std::stoll(spill_ttl_str));
+			}
+			auto threshold_str = cfg["Session"]["CompressThreshold"];
+			if (!threshold_str.empty()) {
+				compress_threshold = std::stoul(threshold_str);
+			}
+			auto high_str = cfg["Session"]["SendHighWater"];
+			if (!high_str.empty()) {
+				high_water = std::stoul(high_str);
+			}
+			auto low_str = cfg["Session"]["SendLowWater"];
+			if (!low_str.empty()) {
+				low_water = std::stoul(low_str);
+			}
+			if (low_water > high_water) {
+				low_water = high_water;
+			}
+			auto policy_str = cfg["Session"]["SlowPolicy"];
+			if (policy_str == "coalesce") {
+				policy = SLOW_COALESCE;
+			}
+			else if (policy_str == "disconnect") {
+				policy = SLOW_DISCONNECT;
+			}
+			else if (policy_str == "spill") {
+				policy = SLOW_SPILL;
+			}
+		}
+	};
+
+	const SendQueConfig& GetSendQueConfig() {
+		static SendQueConfig config;
+		return config;
+	}
+
+	//ֻϢϢͲϲͺ֪ͨÿݣܺϲ
+	bool IsCoalescable(short msg_id) {
+		switch (msg_id) {
+		case ID_HEARTBEAT_RSP:
+		case ID_NOTIFY_OFF_LINE_REQ:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	std::atomic<int64_t> g_total_send_bytes(0);
+	std::atomic<int64_t> g_total_send_drop(0);
+	std::atomic<int64_t> g_total_send_spill(0);
+	std::atomic<int64_t> g_total_slow_close(0);
+
+	//ỰidΪ64λ: ڵid(10λ) | (14λ) | Ŷ(16λ) | (24λ)
+	//ڵidֲͬͬһڵĶ
+	//ÿ̴߳ȫּȡһŶΣ߳ڵҪͬȡһΣ
+	//߳һǰ2^40idظ
+	uint64_t GenSessionId() {
+		static const uint64_t node_id = []() {
+			auto& cfg = ConfigMgr::Inst();
+			auto node_str = cfg["SelfServer"]["NodeId"];
+			if (!node_str.empty()) {
+				return (uint64_t)std::stoull(node_str);
+			}
+			return (uint64_t)std::hash<std::string>()(cfg["SelfServer"]["Name"]);
+		}() & 0x3FF;
+		static const uint64_t boot_id = []() {
+			std::random_device rd;
+			return ((uint64_t)rd() ^ (uint64_t)std::time(nullptr)) & 0x3FFF;
+		}();
+		static std::atomic<uint64_t> block_count(0);
+		thread_local uint64_t block = 0;
+		//Ŵ1ʼ֤idΪ0
+		thread_local uint32_t seq = 0xFFFFFF;
+		if (seq >= 0xFFFFFF) {
+			block = block_count++ & 0xFFFF;
+			seq = 0;
+		}
+		return (node_id << 54) | (boot_id << 40) | (block << 24) | ++seq;
+	}
+}
+
 CSession::CSession(boost::asio::io_context& io_context, CServer* server)
-	:_socket(io_context),_server(server),_b_close(false),_b_head_parse(false),_user_uid(0)
+	:_socket(io_context),_strand(boost::asio::make_strand(io_context)),_server(server),_session_id(0),_b_close(false),
+	_recv_begin(0),_recv_end(0),_big_len(0),_big_cur(0),_big_msg_id(0),_big_flags(0),
+	_frag_len(0),_frag_msg_id(0),_frag_flags(0),_b_ext_head(false),_b_compress(false),_post_head(nullptr),
+	_sending_count(0),_send_bytes(0),_b_over_water(false),_send_drop(0),
+	_b_spill_pending(false),_b_spill_replaying(false),
+	_b_head_parse(false),_user_uid(0),_login_state(LOGIN_STATE_NONE),_codec(CODEC_JSON)
 {
-	boost::uuids::uuid a_uuid = boost::uuids::random_generator()();
-	_session_id = boost::uuids::to_string(a_uuid);
-	_recv_head_node = make_shared<MsgNode>(HEAD_TOTAL_LEN);
+	_session_id = GenSessionId();
+	_recv_buf = new RecvBuffer(RECV_BUFFER_LEN);
+	_send_bufs.reserve(MAX_SEND_BATCH);
+	_last_heartbeat = std::time(nullptr);
 }
 
 CSession::~CSession()
 {
+	//ͷŻûüstrandȡߵϢ
+	SendNode* node = _post_head.exchange(nullptr);
+	while (node != nullptr) {
+		SendNode* next = node->_next;
+		delete node;
+		node = next;
+	}
+	g_total_send_bytes -= _send_bytes;
 	std::cout << "~CSession destruct" << std::endl;
 }
 
@@ -19,7 +139,7 @@ tcp::socket& CSession::GetSocket()
 	return _socket;
 }
 
-std::string& CSession::GetSessionId()
+uint64_t CSession::GetSessionId()
 {
 	return _session_id;
 }
@@ -34,44 +154,408 @@ int CSession::GetUserId()
 	return _user_uid;
 }
 
+bool CSession::MarkLogin()
+{
+	int expected = LOGIN_STATE_NONE;
+	return _login_state.compare_exchange_strong(expected, LOGIN_STATE_ONLINE);
+}
+
+bool CSession::MarkLogout()
+{
+	return _login_state.exchange(LOGIN_STATE_CLOSED) == LOGIN_STATE_ONLINE;
+}
+
 void CSession::Start()
 {
-	AsyncReadHead(HEAD_TOTAL_LEN);
+	auto self = shared_from_this();
+	boost::asio::post(_strand, [self]() {
+		self->AsyncRead();
+		});
 }
 
-void CSession::Send(char* msg, short max_length, short msgid)
+void CSession::Send(const char* msg, std::size_t max_length, short msgid)
 {
-	std::lock_guard<std::mutex> lock(_send_lock);
-	int send_que_size = _send_que.size();
-	if (send_que_size > MAX_SENDQUE) {
-		std::cout << "session: " << _session_id << " send que fulled ,size is " << MAX_SENDQUE << std::endl;
+	//ͷĳֻ2ֽ
+	if (!_b_ext_head && max_length > MAX_LEGACY_LEN) {
+		std::cout << "session: " << _session_id << " msg id " << msgid << " length " << max_length
+			<< " exceeds legacy head, drop" << endl;
 		return;
 	}
-	_send_que.push(make_shared<SendNode>(msg, max_length, msgid));
-	if (send_que_size > 0) {
+	//չͷ³Ƭ޵ϢSendNodeƬͣƴӺĳȲܳԶ˵
+	if (max_length > (MAX_MSG_LEN)) {
+		std::cout << "session: " << _session_id << " msg id " << msgid << " length " << max_length
+			<< " exceeds max msg len, drop" << endl;
 		return;
 	}
-	auto& msgnode = _send_que.front();
-	boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
-		std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
+	//ֵϢѹѹûбСԭ
+	if (_b_compress && max_length >= GetSendQueConfig().compress_threshold) {
+		std::string compressed;
+		if (MsgCompress::Compress(msg, max_length, compressed) && compressed.size() < max_length) {
+			PushSendNode(std::unique_ptr<SendNode>(new SendNode(compressed.data(), compressed.size(),
+				msgid, true, MSG_FLAG_COMPRESS)));
+			return;
+		}
+	}
+	PushSendNode(std::unique_ptr<SendNode>(new SendNode(msg, max_length, msgid, _b_ext_head)));
 }
 
 void CSession::Send(std::string msg, short msgid)
 {
-	std::lock_guard<std::mutex> lock(_send_lock);
-	int send_que_size = _send_que.size();
-	if (send_que_size > MAX_SENDQUE) {
-		std::cout << "session: " << _session_id << " send que fulled, size is " << MAX_SENDQUE << endl;
+	Send(msg.c_str(), msg.length(), msgid);
+}
+
+void CSession::SendMsg(const Json::Value& msg, short msgid)
+{
+	SendMsg(msg, msgid, _codec);
+}
+
+void CSession::SendMsg(const Json::Value& msg, short msgid, int codec)
+{
+	//ÿ̸߳һ뻺󿽱SendNode
+	thread_local std::string data;
+	if (!MsgCodec::GetInstance()->Encode(codec, msgid, msg, data)) {
 		return;
 	}
+	Send(data.data(), data.size(), msgid);
+}
+
+void CSession::SetCodec(int codec)
+{
+	_codec = codec;
+}
+
+int CSession::GetCodec()
+{
+	return _codec;
+}
+
+bool CSession::IsExtHead()
+{
+	return _b_ext_head;
+}
+
+void CSession::SetCompress(bool b_compress)
+{
+	_b_compress = b_compress && _b_ext_head;
+}
+
+void CSession::PushSendNode(std::unique_ptr<SendNode> node)
+{
+	//̶߳Եãѹջأȴio߳
+	SendNode* raw_node = node.release();
+	SendNode* old_head = _post_head.load(std::memory_order_relaxed);
+	do {
+		raw_node->_next = old_head;
+	} while (!_post_head.compare_exchange_weak(old_head, raw_node,
+		std::memory_order_release, std::memory_order_relaxed));
+
+	//ջɿձΪǿʱͶһˢ֮Ϣᱻͬһˢһȡ
+	if (old_head == nullptr) {
+		auto self = shared_from_this();
+		boost::asio::post(_strand, [self]() {
+			self->FlushSendQue();
+			});
+	}
+}
 
-	_send_que.push(make_shared<SendNode>(msg.c_str(), msg.length(), msgid));
-	if (send_que_size > 0) {
+void CSession::FlushSendQue()
+{
+	//strandִУȡͶݵϢջǺȳתָͶ˳
+	SendNode* node = _post_head.exchange(nullptr, std::memory_order_acquire);
+	SendNode* reversed = nullptr;
+	while (node != nullptr) {
+		SendNode* next = node->_next;
+		node->_next = reversed;
+		reversed = node;
+		node = next;
+	}
+
+	while (reversed != nullptr) {
+		std::unique_ptr<SendNode> msgnode(reversed);
+		reversed = reversed->_next;
+		msgnode->_next = nullptr;
+		EnqueueSendNode(std::move(msgnode));
+	}
+
+	if (_b_close) {
+		return;
+	}
+
+	//ѾдڽУдɺϢһϲ
+	if (_sending_count > 0 || _send_que.empty()) {
+		return;
+	}
+	AsyncWrite();
+}
+
+void CSession::SendInStrand(const std::string& msg, short msgid)
+{
+	EnqueueSendNode(std::unique_ptr<SendNode>(new SendNode(msg.c_str(), msg.length(), msgid, _b_ext_head)));
+	if (_b_close || _sending_count > 0 || _send_que.empty()) {
+		return;
+	}
+	AsyncWrite();
+}
+
+void CSession::EnqueueSendNode(std::unique_ptr<SendNode> node)
+{
+	//ѹرյĻỰٻѹϢ
+	if (_b_close) {
+		++_send_drop;
+		++g_total_send_drop;
 		return;
 	}
-	auto& msgnode = _send_que.front();
-	boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
-		std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
+
+	auto& config = GetSendQueConfig();
+	std::size_t node_len = node->_total_len;
+	if (!_b_over_water && _send_bytes + node_len > config.high_water) {
+		_b_over_water = true;
+		std::cout << "session: " << _session_id << " send que over high water, bytes is "
+			<< _send_bytes << endl;
+	}
+
+	if (_b_over_water) {
+		switch (config.policy) {
+		case SLOW_DISCONNECT:
+			//ͻֱ̫ӶϿɿͻȡ
+			std::cout << "session: " << _session_id << " slow consumer, disconnect" << endl;
+			++_send_drop;
+			++g_total_send_drop;
+			++g_total_slow_close;
+			Close();
+			_server->ClearSession(_session_id);
+			return;
+		case SLOW_SPILL:
+			//ѹڼϢת浽߶УռûỰڴ
+			SpillSendNode(std::move(node));
+			return;
+		case SLOW_COALESCE:
+			//滻͵ľϢѾʱϢ滻ͰϢ
+			if (IsCoalescable(node->_msg_id) && CoalesceSendNode(node->_msg_id)) {
+				break;
+			}
+			DropOldest(config.high_water > node_len ? config.high_water - node_len : 0);
+			break;
+		default:
+			DropOldest(config.low_water > node_len ? config.low_water - node_len : 0);
+			break;
+		}
+	}
+
+	_send_bytes += node_len;
+	g_total_send_bytes += node_len;
+	_send_que.push_back(std::move(node));
+}
+
+void CSession::PopSendNode(std::deque<std::unique_ptr<SendNode> >::iterator iter)
+{
+	std::size_t node_len = (*iter)->_total_len;
+	_send_bytes -= node_len;
+	g_total_send_bytes -= node_len;
+	_send_que.erase(iter);
+}
+
+void CSession::DropOldest(std::size_t target_bytes)
+{
+	//ڷеϢѾsocketֻܶδ͵Ϣ
+	int64_t drop_count = 0;
+	while (_send_bytes > target_bytes && _send_que.size() > _sending_count) {
+		PopSendNode(_send_que.begin() + _sending_count);
+		++drop_count;
+	}
+	if (drop_count > 0) {
+		_send_drop += drop_count;
+		g_total_send_drop += drop_count;
+	}
+}
+
+bool CSession::CoalesceSendNode(short msg_id)
+{
+	bool b_coalesced = false;
+	for (auto iter = _send_que.begin() + _sending_count; iter != _send_que.end();) {
+		if ((*iter)->_msg_id != msg_id) {
+			++iter;
+			continue;
+		}
+		std::size_t offset = iter - _send_que.begin();
+		PopSendNode(iter);
+		iter = _send_que.begin() + offset;
+		++_send_drop;
+		++g_total_send_drop;
+		b_coalesced = true;
+	}
+	return b_coalesced;
+}
+
+void CSession::SpillSendNode(std::unique_ptr<SendNode> node)
+{
+	int uid = _user_uid;
+	if (uid == 0) {
+		++_send_drop;
+		++g_total_send_drop;
+		return;
+	}
+
+	//߶ÿ¼Ϊ Ϣid|־|Э|Ϣ壬ѹ־ͱЭ飬·ʱݴ˻ԭ
+	std::string value = std::to_string(node->_msg_id) + "|" + std::to_string(node->_flags) + "|"
+		+ std::to_string((int)_codec) + "|";
+	value.append(node->_data + node->_head_len, node->_total_len - node->_head_len);
+	std::string key = OFFLINE_MSG_PREFIX + std::to_string(uid);
+	auto& config = GetSendQueConfig();
+	//strandϲͬredis첽ӣͬһkeyͬһӣ˳ִ
+	auto self = shared_from_this();
+	auto async_redis = AsyncRedis::GetInstance();
+	async_redis->Command({ "RPUSH", key, std::move(value) }, [self](const RedisResult& result) {
+		if (result.type != RESULT_INTEGER) {
+			++self->_send_drop;
+			++g_total_send_drop;
+			return;
+		}
+		++g_total_send_spill;
+		});
+	//ֻµspill_max_lenһʱûе¼ȡ
+	async_redis->Command({ "LTRIM", key, std::to_string(-config.spill_max_len), "-1" });
+	async_redis->Command({ "EXPIRE", key, std::to_string(config.spill_ttl) });
+	_b_spill_pending = true;
+}
+
+void CSession::TryReplaySpill()
+{
+	if (!_b_spill_pending || _b_spill_replaying || _b_close || _b_over_water) {
+		return;
+	}
+	int uid = _user_uid;
+	if (uid == 0) {
+		return;
+	}
+	_b_spill_pending = false;
+	_b_spill_replaying = true;
+
+	//ȡͲüͬһϣм䲻뱾ỰתȡڼתϢλ_b_spill_pending
+	std::string key = OFFLINE_MSG_PREFIX + std::to_string(uid);
+	auto self = shared_from_this();
+	auto async_redis = AsyncRedis::GetInstance();
+	async_redis->Command({ "LRANGE", key, "0", std::to_string(SPILL_REPLAY_BATCH - 1) },
+		[self](const RedisResult& result) {
+		boost::asio::post(self->_strand, [self, result]() {
+			self->_b_spill_replaying = false;
+			if (result.type != RESULT_ARRAY) {
+				std::cout << "session: " << self->_session_id << " fetch spilled msg failed" << endl;
+				//ûд˵üҲûִУ´дʱ
+				if (result.b_not_sent) {
+					self->_b_spill_pending = true;
+				}
+				return;
+			}
+			for (auto& record : result.elements) {
+				self->ReplaySpilled(record.str);
+			}
+			//ȡһ˵ܻʣ࣬һͳȥȡ
+			if (result.elements.size() >= (std::size_t)SPILL_REPLAY_BATCH) {
+				self->_b_spill_pending = true;
+			}
+			});
+		});
+	async_redis->Command({ "LTRIM", key, std::to_string(SPILL_REPLAY_BATCH), "-1" });
+}
+
+void CSession::ReplaySpilled(std::string_view record)
+{
+	// Ϣid|־|Э|Ϣ
+	std::size_t pos[3] = { 0 };
+	std::size_t start = 0;
+	for (int i = 0; i < 3; ++i) {
+		pos[i] = record.find('|', start);
+		if (pos[i] == std::string_view::npos) {
+			std::cout << "session: " << _session_id << " invalid spilled record" << endl;
+			return;
+		}
+		start = pos[i] + 1;
+	}
+	short msg_id = (short)std::atoi(std::string(record.substr(0, pos[0])).c_str());
+	unsigned short flags = (unsigned short)std::atoi(std::string(record.substr(pos[0] + 1, pos[1] - pos[0] - 1)).c_str());
+	int codec = std::atoi(std::string(record.substr(pos[1] + 1, pos[2] - pos[1] - 1)).c_str());
+	std::string_view body = record.substr(pos[2] + 1);
+
+	//»ỰѹȽѹ
+	std::string raw;
+	if ((flags & MSG_FLAG_COMPRESS) != 0) {
+		if (!MsgCompress::Decompress(body.data(), body.size(), raw, MAX_MSG_LEN)) {
+			std::cout << "session: " << _session_id << " decompress spilled msg failed, msg id is " << msg_id << endl;
+			return;
+		}
+		body = raw;
+	}
+
+	//Э̵Э鲻ͬʱȽٰЭ
+	if (codec != _codec) {
+		Json::Value root;
+		if (!MsgCodec::GetInstance()->Decode(codec, msg_id, body, root)) {
+			std::cout << "session: " << _session_id << " decode spilled msg failed, msg id is " << msg_id << endl;
+			return;
+		}
+		SendMsg(root, msg_id);
+		return;
+	}
+	Send(body.data(), body.size(), msg_id);
+}
+
+std::size_t CSession::GetSendQueBytes()
+{
+	return _send_bytes;
+}
+
+int64_t CSession::GetSendDropCount()
+{
+	return _send_drop;
+}
+
+bool CSession::IsOverWater()
+{
+	return _b_over_water;
+}
+
+int64_t CSession::GetTotalSendQueBytes()
+{
+	return g_total_send_bytes;
+}
+
+int64_t CSession::GetTotalSendDrop()
+{
+	return g_total_send_drop;
+}
+
+int64_t CSession::GetTotalSendSpill()
+{
+	return g_total_send_spill;
+}
+
+int64_t CSession::GetTotalSlowClose()
+{
+	return g_total_slow_close;
+}
+
+void CSession::AsyncWrite()
+{
+	//strandִУѶͷĶϢϲһasync_write
+	_send_bufs.clear();
+	std::size_t batch_len = 0;
+	std::size_t batch_count = 0;
+	for (auto& msgnode : _send_que) {
+		if (batch_count >= MAX_SEND_BATCH) {
+			break;
+		}
+		if (batch_count > 0 && batch_len + msgnode->_total_len > MAX_SEND_BATCH_LEN) {
+			break;
+		}
+		//ƬϢһڵӦλ
+		msgnode->GetBuffers(_send_bufs);
+		batch_len += msgnode->_total_len;
+		++batch_count;
+	}
+	_sending_count = batch_count;
+	boost::asio::async_write(_socket, _send_bufs, boost::asio::bind_executor(_strand,
+		std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf())));
 }
 
 void CSession::Close()
@@ -82,121 +566,283 @@ void CSession::Close()
 
 std::shared_ptr<CSession> CSession::SharedSelf()
 {
-	return std::shared_ptr<CSession>();
+	return shared_from_this();
 }
 
-void CSession::AsyncReadBody(int total_len)
+void CSession::AsyncRead()
 {
-	auto self = shared_from_this();
-	asyncReadFull(total_len, [self,this,total_len](const boost::system::error_code& ec, std::size_t bytes_transfered) {
-		try
-		{
-			if (ec)
-			{
-				std::cout << "handle read failed, error is " << ec.what() << endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
-			}
-			if (bytes_transfered<total_len)
-			{
-				std::cout << "read length not match, read [" << bytes_transfered << "] , total ["
-					<< total_len << "]" << endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
+	//ڽմϢֱӶϢУֻȡϢʣĲ
+	if (_big_buf != nullptr) {
+		_socket.async_read_some(boost::asio::buffer(_big_buf->_data + _big_cur, _big_len - _big_cur),
+			boost::asio::bind_executor(_strand, std::bind(&CSession::HandleRead, this,
+				std::placeholders::_1, std::placeholders::_2, shared_from_this())));
+		return;
+	}
+
+	//ʣռ䲻һСϢʱ
+	if (RECV_BUFFER_LEN - _recv_begin < HEAD_EXT_TOTAL_LEN + MAX_LENGTH) {
+		std::size_t remain = _recv_end - _recv_begin;
+		if (_recv_buf->UseCount() == 1) {
+			//ûRecvNodeøûֱӰδƵͷ
+			::memmove(_recv_buf->_data, _recv_buf->_data + _recv_begin, remain);
+		}
+		else {
+			//߼߳еϢãһµģֻδİϢ
+			boost::intrusive_ptr<RecvBuffer> new_buf(new RecvBuffer(RECV_BUFFER_LEN));
+			memcpy(new_buf->_data, _recv_buf->_data + _recv_begin, remain);
+			_recv_buf = new_buf;
+		}
+		_recv_begin = 0;
+		_recv_end = remain;
+	}
+
+	_socket.async_read_some(boost::asio::buffer(_recv_buf->_data + _recv_end, RECV_BUFFER_LEN - _recv_end),
+		boost::asio::bind_executor(_strand, std::bind(&CSession::HandleRead, this,
+			std::placeholders::_1, std::placeholders::_2, shared_from_this())));
+}
+
+void CSession::HandleRead(const boost::system::error_code& error, std::size_t bytes_transferred, std::shared_ptr<CSession> shared_self)
+{
+	try
+	{
+		if (error) {
+			std::cout << "handle read failed, error is " << error.what() << endl;
+			Close();
+			_server->ClearSession(_session_id);
+			return;
+		}
+		//յκݶԾ
+		_last_heartbeat = std::time(nullptr);
+		if (_big_buf != nullptr) {
+			_big_cur += bytes_transferred;
+			if (_big_cur == _big_len) {
+				auto big_buf = std::move(_big_buf);
+				if (!DeliverMsg(big_buf, big_buf->_data, _big_len, _big_msg_id, _big_flags)) {
+					return;
+				}
 			}
-			memcpy(_recv_msg_node->_data, _data, bytes_transfered);
-			_recv_msg_node->_cur_len += bytes_transfered;
-			_recv_msg_node->_data[_recv_msg_node->_total_len] = '\0';
-			std::cout << "receive data is " << _recv_msg_node->_data << endl;
-			//˴ϢͶݵ߼
-			LogicSystem::GetInstance()->PostMsgToQue(make_shared<LogicNode>(shared_from_this(), _recv_msg_node));
-			//ͷ¼
-			AsyncReadHead(HEAD_TOTAL_LEN);
+			AsyncRead();
+			return;
 		}
-		catch (const std::exception& e)
-		{
-			std::cout << "Exception code is " << e.what() << endl;
+
+		_recv_end += bytes_transferred;
+		//һζȡܰϢȫٷһζ
+		if (!ParseMsg()) {
+			return;
 		}
-		});
+		AsyncRead();
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << "Exception code is " << e.what() << endl;
+	}
 }
 
-void CSession::AsyncReadHead(int total_len)
+bool CSession::ParseMsg()
 {
-	auto self =shared_from_this();
-	asyncReadFull(HEAD_TOTAL_LEN, [self, this](const boost::system::error_code& ec,std::size_t bytes_transfered){
-		try
-		{
-			if (ec) {
-				std::cout << "headle read failed,error is" << ec.what() << endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
+	while (_recv_end - _recv_begin >= HEAD_TOTAL_LEN) {
+		const char* head = _recv_buf->_data + _recv_begin;
+		unsigned short head_id = 0;
+		memcpy(&head_id, head, HEAD_ID_LEN);
+		head_id = boost::asio::detail::socket_ops::network_to_host_short(head_id);
+		//idλΪ1ʾչͷ
+		bool b_ext_head = (head_id & HEAD_EXT_MASK) != 0;
+		short msg_id = head_id & ~HEAD_EXT_MASK;
+		if (msg_id > MAX_LENGTH) {
+			std::cout << "invalid msg_id is " << msg_id << endl;
+			CloseInvalid();
+			return false;
+		}
+
+		std::size_t head_len = HEAD_TOTAL_LEN;
+		std::size_t msg_len = 0;
+		unsigned short flags = 0;
+		if (!b_ext_head) {
+			short legacy_len = 0;
+			memcpy(&legacy_len, head + HEAD_ID_LEN, HEAD_DATA_LEN);
+			legacy_len = boost::asio::detail::socket_ops::network_to_host_short(legacy_len);
+			if (legacy_len < 0 || legacy_len > MAX_LENGTH) {
+				std::cout << "invalid data length is " << legacy_len << endl;
+				CloseInvalid();
+				return false;
 			}
-			if (bytes_transfered < HEAD_TOTAL_LEN) {
-				std::cout << "read length not match..." << ec.what() << endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;	
+			msg_len = legacy_len;
+		}
+		else {
+			//չͷûȫ
+			if (_recv_end - _recv_begin < HEAD_EXT_TOTAL_LEN) {
+				break;
+			}
+			head_len = HEAD_EXT_TOTAL_LEN;
+			memcpy(&flags, head + HEAD_ID_LEN, HEAD_FLAG_LEN);
+			flags = boost::asio::detail::socket_ops::network_to_host_short(flags);
+			uint32_t ext_len = 0;
+			memcpy(&ext_len, head + HEAD_ID_LEN + HEAD_FLAG_LEN, HEAD_EXT_DATA_LEN);
+			ext_len = boost::asio::detail::socket_ops::network_to_host_long(ext_len);
+			if (ext_len > MAX_FRAME_LEN) {
+				std::cout << "invalid frame length is " << ext_len << endl;
+				CloseInvalid();
+				return false;
 			}
-			_recv_head_node->Clear();
-			memcpy(_recv_head_node->_data, _data, bytes_transfered);
+			msg_len = ext_len;
+			_b_ext_head = true;
+		}
 
+		//δ¼ֻܷŽջĵ֡Ϣֻƾһͷڴ
+		if (_login_state != LOGIN_STATE_ONLINE
+			&& (head_len + msg_len > HEAD_EXT_TOTAL_LEN + MAX_LENGTH || (flags & MSG_FLAG_MORE) != 0)) {
+			std::cout << "session: " << _session_id << " large or fragmented frame before login, length is "
+				<< msg_len << endl;
+			CloseInvalid();
+			return false;
+		}
 
-			short msg_id = 0;
-			memcpy(&msg_id, _recv_head_node->_data, HEAD_ID_LEN);
-			msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
-			if (msg_id > MAX_LENGTH) {
-				std::cout << "invalid msg_id is " << msg_id << endl;
-				_server->ClearSession(_session_id);
-				return;
+		std::size_t avail = _recv_end - _recv_begin - head_len;
+		//ŲջĴϢ뵥ĻյĲֿȥʣಿֱӶ
+		if (head_len + msg_len > HEAD_EXT_TOTAL_LEN + MAX_LENGTH) {
+			std::size_t copy_len = (std::min)(avail, msg_len);
+			_big_buf = new RecvBuffer(msg_len);
+			memcpy(_big_buf->_data, head + head_len, copy_len);
+			_big_len = msg_len;
+			_big_cur = copy_len;
+			_big_msg_id = msg_id;
+			_big_flags = flags;
+			_recv_begin += head_len + copy_len;
+			if (_big_cur < _big_len) {
+				break;
 			}
-
-			
-			short msg_len = 0;
-			memcpy(&msg_len, _recv_head_node->_data + HEAD_ID_LEN, HEAD_DATA_LEN);
-			msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
-			if (msg_len > MAX_LENGTH) {
-				std::cout << "invalid data length is " << msg_len << endl;
-				_server->ClearSession(_session_id);
-				return;
+			auto big_buf = std::move(_big_buf);
+			if (!DeliverMsg(big_buf, big_buf->_data, _big_len, _big_msg_id, _big_flags)) {
+				return false;
 			}
-			_recv_msg_node = make_shared<RecvNode>(msg_len, msg_id);
-			AsyncReadBody(msg_len);
+			continue;
 		}
-		catch (const std::exception& e)
-		{
-			std::cout << "Exception code is " << e.what() << endl;
+
+		//Ϣ廹ûȫȴһζȡ
+		if (avail < msg_len) {
+			break;
 		}
-		});
+
+		//ֱio̻߳ظ߼УԴϢķƬ֮
+		if (msg_id == ID_HEART_BEAT_REQ && (flags & MSG_FLAG_MORE) == 0
+			&& (_frag_buf == nullptr || _frag_msg_id != msg_id)) {
+			_recv_begin += head_len + msg_len;
+			//protobufЭerrorΪ0ĻذΪ
+			SendInStrand(_codec == CODEC_PROTOBUF ? std::string() : HEARTBEAT_RSP_DATA, ID_HEARTBEAT_RSP);
+			continue;
+		}
+
+		if (!DeliverMsg(_recv_buf, head + head_len, msg_len, msg_id, flags)) {
+			return false;
+		}
+		_recv_begin += head_len + msg_len;
+	}
+
+	if (_recv_begin == _recv_end && _recv_buf->UseCount() == 1) {
+		_recv_begin = _recv_end = 0;
+	}
+	return true;
+}
+
+bool CSession::DeliverMsg(boost::intrusive_ptr<RecvBuffer> buffer, const char* data, std::size_t len,
+	short msg_id, unsigned short flags)
+{
+	//ƴӵϢֱ֡ͶݣԴڷƬ֮
+	if ((flags & MSG_FLAG_MORE) == 0 && (_frag_buf == nullptr || msg_id != _frag_msg_id)) {
+		return PostMsg(buffer, data, len, msg_id, flags);
+	}
+
+	if (_frag_buf == nullptr) {
+		_frag_len = 0;
+		_frag_msg_id = msg_id;
+		_frag_flags = 0;
+	}
+	if (msg_id != _frag_msg_id || _frag_len + len > MAX_MSG_LEN) {
+		std::cout << "invalid fragment, msg id is " << msg_id << " length is " << _frag_len + len << endl;
+		CloseInvalid();
+		return false;
+	}
+
+	//ƴӻڴ룬ռ䲻ʱ
+	if (_frag_buf == nullptr || _frag_len + len > _frag_buf->_capacity) {
+		std::size_t capacity = _frag_buf == nullptr ? 0 : _frag_buf->_capacity;
+		capacity = (std::max)(capacity * 2, _frag_len + len);
+		boost::intrusive_ptr<RecvBuffer> new_buf(new RecvBuffer(capacity));
+		if (_frag_buf != nullptr) {
+			memcpy(new_buf->_data, _frag_buf->_data, _frag_len);
+		}
+		_frag_buf = new_buf;
+	}
+	memcpy(_frag_buf->_data + _frag_len, data, len);
+	_frag_len += len;
+	//ѹ־ƴӺϢ
+	_frag_flags |= flags;
+	if ((flags & MSG_FLAG_MORE) != 0) {
+		return true;
+	}
+
+	//һƬ룬ϢͶݵ߼
+	auto frag_buf = std::move(_frag_buf);
+	std::size_t frag_len = _frag_len;
+	_frag_len = 0;
+	return PostMsg(frag_buf, frag_buf->_data, frag_len, _frag_msg_id, _frag_flags);
+}
+
+bool CSession::PostMsg(boost::intrusive_ptr<RecvBuffer> buffer, const char* data, std::size_t len,
+	short msg_id, unsigned short flags)
+{
+	if ((flags & MSG_FLAG_COMPRESS) != 0) {
+		//δ¼ʱѹĳҲСϢ
+		std::size_t max_len = _login_state == LOGIN_STATE_ONLINE ? (MAX_MSG_LEN) : MAX_LENGTH;
+		//ֱӽѹڴĻУRecvNodeýѹ
+		boost::intrusive_ptr<RecvBuffer> raw_buf;
+		std::size_t raw_len = 0;
+		if (!MsgCompress::Decompress(data, len, raw_buf, raw_len, max_len)) {
+			std::cout << "decompress msg failed, msg id is " << msg_id << endl;
+			CloseInvalid();
+			return false;
+		}
+		buffer = raw_buf;
+		data = buffer->_data;
+		len = raw_len;
+	}
+
+	//RecvNodeֱûеϢ壬Ͷݵ߼
+	std::unique_ptr<RecvNode> recv_node(new RecvNode(buffer, data, len, msg_id));
+	LogicSystem::GetInstance()->PostMsgToQue(std::unique_ptr<LogicNode>(new LogicNode(shared_from_this(), std::move(recv_node))));
+	return true;
+}
+
+void CSession::CloseInvalid()
+{
+	Close();
+	_server->ClearSession(_session_id);
 }
 
 void CSession::NotifyOffline(int uid)
 {
 }
 
-void CSession::asyncReadFull(std::size_t maxLength, std::function<void(const boost::system::error_code&, std::size_t)> handler)
+bool CSession::IsClosed()
+{
+	return _b_close;
+}
+
+time_t CSession::GetLastHeartbeat()
 {
-	::memset(_data, 0, MAX_LENGTH);
-	asyncReadLen(0, maxLength, handler);
+	return _last_heartbeat;
 }
 
-void CSession::asyncReadLen(std::size_t read_len, std::size_t total_len, 
-	std::function<void(const boost::system::error_code&, std::size_t)> handler)
+void CSession::CloseIdle()
 {
 	auto self = shared_from_this();
-	_socket.async_read_some(boost::asio::buffer(_data + read_len, total_len - read_len),
-		[read_len, total_len, handler, self](const boost::system::error_code& ec, std::size_t bytesTransfered) {
-			if (ec) {
-				handler(ec, read_len + bytesTransfered);
-				return;
-			}
-			if (read_len+bytesTransfered>=total_len) {
-				handler(ec, read_len + bytesTransfered);
-				return;
-			}
-			self->asyncReadLen(read_len + bytesTransfered, total_len, handler);
+	boost::asio::post(_strand, [self]() {
+		if (self->_b_close) {
+			return;
+		}
+		std::cout << "session: " << self->_session_id << " heartbeat timeout, close" << endl;
+		self->Close();
+		self->_server->ClearSession(self->_session_id);
 		});
 }
 
@@ -205,14 +851,18 @@ void CSession::HandleWrite(const boost::system::error_code& error, std::shared_p
 	try
 	{
 		if (!error) {
-			std::lock_guard<std::mutex> lock(_send_lock);
-			_send_que.pop();
+			//κϲɵϢ
+			for (std::size_t i = 0; i < _sending_count; ++i) {
+				PopSendNode(_send_que.begin());
+			}
+			_sending_count = 0;
+			if (_b_over_water && _send_bytes <= GetSendQueConfig().low_water) {
+				_b_over_water = false;
+			}
+			TryReplaySpill();
 			if (!_send_que.empty()) {
-				auto& msgnode = _send_que.front();
-				boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
-					std::bind(&CSession::HandleWrite, this, std::placeholders::_1, shared_self));
+				AsyncWrite();
 			}
-			std::cout << "ذ" << std::endl;
 		}
 		else {
 			std::cout << "handle write failed, error is " << error.what() << endl;
@@ -226,6 +876,6 @@ void CSession::HandleWrite(const boost::system::error_code& error, std::shared_p
 	}
 }
 
-LogicNode::LogicNode(shared_ptr<CSession> session, shared_ptr<RecvNode> recvnode):_session(session),_recvnode(recvnode)
+LogicNode::LogicNode(shared_ptr<CSession> session, std::unique_ptr<RecvNode> recvnode):_session(session),_recvnode(std::move(recvnode))
 {
 }
@@ -1,7 +1,8 @@
 #pragma once
 #include"const.h"
 #include "MsgNode.h"
-#include <queue>
+#include <deque>
+#include <vector>
 #include <mutex>
 #include <memory>
 
@@ -13,46 +14,125 @@ public:
 	CSession(boost::asio::io_context& io_context, CServer* server);
 	~CSession();
 	tcp::socket& GetSocket();
-	std::string& GetSessionId();
+	uint64_t GetSessionId();
 	void SetUserId(int uid);
 	int GetUserId();
+	//¼ɹfalse˵ѾỰѹر
+	bool MarkLogin();
+	//Ựرʱãtrue˵֮ǰҪۼ
+	bool MarkLogout();
 	void Start();
-	void Send(char* msg, short max_length, short msgid);
+	void Send(const char* msg, std::size_t max_length, short msgid);
 	void Send(std::string msg, short msgid);
+	//ỰЭ̵Э
+	void SendMsg(const Json::Value& msg, short msgid);
+	void SendMsg(const Json::Value& msg, short msgid, int codec);
+	void SetCodec(int codec);
+	int GetCodec();
+	//ѹչͷеı־λֻʹչͷĻỰܿ
+	bool IsExtHead();
+	void SetCompress(bool b_compress);
 	void Close();
 	std::shared_ptr<CSession> SharedSelf();
-	void AsyncReadBody(int total_len);
-	void AsyncReadHead(int total_len);
+	void AsyncRead();
 	void NotifyOffline(int  uid);
+	bool IsClosed();
+	time_t GetLastHeartbeat();
+	//ʱּ⵽ỰʱãͶݵỰstrandϹر
+	void CloseIdle();
+	//ͶеǰѹֽۼƶϢͳʹ
+	std::size_t GetSendQueBytes();
+	int64_t GetSendDropCount();
+	bool IsOverWater();
+	//·ͻѹʱת浽߶еϢ¼ʱڼ䷢ͶлãrecordΪSpillSendNodeдһ¼
+	void ReplaySpilled(std::string_view record);
+	//лỰܵķͶͳ
+	static int64_t GetTotalSendQueBytes();
+	static int64_t GetTotalSendDrop();
+	static int64_t GetTotalSendSpill();
+	static int64_t GetTotalSlowClose();
 private:
-	void asyncReadFull(std::size_t maxLength, std::function<void(const boost::system::error_code&, std::size_t)> handler);
-	void asyncReadLen(std::size_t read_len, std::size_t total_len, std::function<void(const boost::system::error_code&, std::size_t)> handler);
+	void HandleRead(const boost::system::error_code& error, std::size_t bytes_transferred, std::shared_ptr<CSession> shared_self);
+	bool ParseMsg();
+	//һϢƬ߼㣬Ƭƴӵ_frag_buf
+	bool DeliverMsg(boost::intrusive_ptr<RecvBuffer> buffer, const char* data, std::size_t len,
+		short msg_id, unsigned short flags);
+	//ϢͶݵ߼УѹȽѹ
+	bool PostMsg(boost::intrusive_ptr<RecvBuffer> buffer, const char* data, std::size_t len,
+		short msg_id, unsigned short flags);
+	void CloseInvalid();
+	void PushSendNode(std::unique_ptr<SendNode> node);
+	void FlushSendQue();
+	void EnqueueSendNode(std::unique_ptr<SendNode> node);
+	//strandֱӻظ߼߳
+	void SendInStrand(const std::string& msg, short msgid);
+	void DropOldest(std::size_t target_bytes);
+	bool CoalesceSendNode(short msg_id);
+	void SpillSendNode(std::unique_ptr<SendNode> node);
+	//Ͷл䵽ˮλº󣬰ڼתϢȡ·
+	void TryReplaySpill();
+	void PopSendNode(std::deque<std::unique_ptr<SendNode> >::iterator iter);
+	void AsyncWrite();
 	void HandleWrite(const boost::system::error_code& error, std::shared_ptr<CSession> shared_self);
 	tcp::socket _socket;
+	//ỰĶдصstrandϴִУͶֻstrandϲҪ
+	boost::asio::strand<boost::asio::io_context::executor_type> _strand;
 	CServer* _server;
-	std::string _session_id;
+	uint64_t _session_id;
 	bool _b_close;
-	char _data[MAX_LENGTH]; //ϢֽڴС
-	std::queue<std::shared_ptr<SendNode> > _send_que;
-	std::mutex _send_lock;
-	//յϢṹ
-	std::shared_ptr<RecvNode> _recv_msg_node;
+	//ջ[_recv_begin, _recv_end)Ϊյδ
+	boost::intrusive_ptr<RecvBuffer> _recv_buf;
+	std::size_t _recv_begin;
+	std::size_t _recv_end;
+	//ջĴϢһ黺ʣಿֱӶ
+	boost::intrusive_ptr<RecvBuffer> _big_buf;
+	std::size_t _big_len;
+	std::size_t _big_cur;
+	short _big_msg_id;
+	unsigned short _big_flags;
+	//ƬƴӻյMSG_FLAG_MORE־ķƬʱʹ
+	boost::intrusive_ptr<RecvBuffer> _frag_buf;
+	std::size_t _frag_len;
+	short _frag_msg_id;
+	unsigned short _frag_flags;
+	//ͻʹչͷ󣬻ذҲʹչͷ
+	std::atomic<bool> _b_ext_head;
+	//¼ʱЭֵ̿Ļذѹ
+	std::atomic<bool> _b_compress;
+	//߳ͶݵĴϢջstrandȡߺͶ˳_send_que
+	std::atomic<SendNode*> _post_head;
+	std::deque<std::unique_ptr<SendNode> > _send_que;
+	//ڷеϢЩϢλ_send_queͷ
+	std::size_t _sending_count;
+	//ϲʱĻ
+	std::vector<boost::asio::const_buffer> _send_bufs;
+	//_send_queлѹֽstrand޸ģֻ߳
+	std::atomic<std::size_t> _send_bytes;
+	//ˮλλ䵽ˮλ²strand޸ģͳ̶߳ȡ
+	std::atomic<bool> _b_over_water;
+	std::atomic<int64_t> _send_drop;
+	//߶лбỰʱתϢԼǷȡأֻstrandϷ
+	bool _b_spill_pending;
+	bool _b_spill_replaying;
 	bool _b_head_parse;
-	//յͷṹ
-	std::shared_ptr<MsgNode> _recv_head_node;
-	int _user_uid;
+	//߼߳д룬io̶߳ȡڷƬ
+	std::atomic<int> _user_uid;
+	//߼״̬߼̵߳¼io̹߳رտͬʱCASֻ֤Ӽһ
+	std::atomic<int> _login_state;
+	//¼Э̵ĿͻЭ飬߼߳д룬io̺߳grpc̶߳ȡ
+	std::atomic<int> _codec;
 	//¼ϴνݵʱ
 	std::atomic<time_t> _last_heartbeat;
 	//session 
 	std::mutex _session_mtx;
 };
-class LogicNode {
+class LogicNode :public PoolObject<LogicNode> {
 	friend class LogicSystem;
 public:
-	LogicNode(shared_ptr<CSession>, shared_ptr<RecvNode>);
+	LogicNode(shared_ptr<CSession>, std::unique_ptr<RecvNode>);
 private:
 	shared_ptr<CSession> _session;
-	shared_ptr<RecvNode> _recvnode;
+	std::unique_ptr<RecvNode> _recvnode;
 };
 
 
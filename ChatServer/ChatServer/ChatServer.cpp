@@ -8,6 +8,14 @@
 #include "ConfigMgr.h"
 #include "RedisMgr.h"
 #include "ChatServiceImpl.h"
+#include "StatsMgr.h"
+#include "MsgPool.h"
+#include "MsgCompress.h"
+#include "AsyncRedis.h"
+#include "UserCache.h"
+#include "OnlineCounter.h"
+#include "RedisBus.h"
+#include "ChatGrpcClient.h"
 int main()
 {
 	auto& cfg = ConfigMgr::Inst();
@@ -15,6 +23,8 @@ int main()
 	try
 	{
 		auto pool = AsioIOServicePool::GetInstance();
+		//异步redis连接挂在io线程池上，提前建立连接
+		AsyncRedis::GetInstance();
 		//将登录数设置为0
 		RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, "0");
 		//定义一个GrpcServer
@@ -37,11 +47,53 @@ int main()
 		boost::asio::signal_set signals(io_context, SIGINT, SIGTERM);
 		signals.async_wait([&io_context, pool, &server](auto, auto) {
 			io_context.stop();
+			OnlineCounter::GetInstance()->Stop();
+			RedisBus::GetInstance()->Stop();
+			UserCache::GetInstance()->Stop();
+			AsyncRedis::GetInstance()->Close();
 			pool->Stop();
 			server->Shutdown();
 			});
 		auto port_str = cfg["SelfServer"]["Port"];
 		CServer s(io_context, atoi(port_str.c_str()));
+		//定时上报运行统计
+		auto stats = StatsMgr::GetInstance();
+		stats->RegCollector("msgpool_hit", []() { return (int64_t)MsgPool::GetHitCount(); });
+		stats->RegCollector("msgpool_miss", []() { return (int64_t)MsgPool::GetMissCount(); });
+		stats->RegCollector("sendque_bytes", []() { return CSession::GetTotalSendQueBytes(); });
+		stats->RegCollector("sendque_max_bytes", [&s]() { return s.GetMaxSendQueBytes(); });
+		stats->RegCollector("send_drop", []() { return CSession::GetTotalSendDrop(); });
+		stats->RegCollector("send_drop_max", [&s]() { return s.GetMaxSendDrop(); });
+		stats->RegCollector("sendque_over_water", [&s]() { return s.GetOverWaterCount(); });
+		stats->RegCollector("send_spill", []() { return CSession::GetTotalSendSpill(); });
+		stats->RegCollector("slow_close", []() { return CSession::GetTotalSlowClose(); });
+		stats->RegCollector("compress_raw_bytes", []() { return MsgCompress::GetRawBytes(); });
+		stats->RegCollector("compress_out_bytes", []() { return MsgCompress::GetCompressedBytes(); });
+		//redis连接池等待时间分布，桶名为等待时间上限
+		const char* wait_names[REDIS_WAIT_BUCKET_NUM] = { "100us", "1ms", "10ms", "100ms", "inf" };
+		for (int i = 0; i < REDIS_WAIT_BUCKET_NUM; ++i) {
+			stats->RegCollector(std::string("redis_wait_") + wait_names[i], [i]() {
+				return RedisMgr::GetInstance()->GetPoolWaitCount(i); });
+		}
+		stats->RegCollector("redis_wait_timeout", []() { return RedisMgr::GetInstance()->GetPoolTimeoutCount(); });
+		stats->RegCollector("redis_idle", []() { return RedisMgr::GetInstance()->GetPoolIdleCount(); });
+		stats->RegCollector("online", []() { return OnlineCounter::GetInstance()->GetOnline(); });
+		stats->RegCollector("user_cache_hit", []() { return UserCache::GetInstance()->GetHitCount(); });
+		stats->RegCollector("user_cache_miss", []() { return UserCache::GetInstance()->GetMissCount(); });
+		stats->RegCollector("user_cache_size", []() { return UserCache::GetInstance()->GetSize(); });
+		stats->RegCollector("user_cache_neg_hit", []() { return UserCache::GetInstance()->GetNegativeHitCount(); });
+		stats->RegCollector("user_load_coalesced", []() { return UserCache::GetInstance()->GetCoalescedCount(); });
+		stats->RegCollector("user_load_db", []() { return UserCache::GetInstance()->GetDbLoadCount(); });
+		//两种跨服务器通知方式的耗时分布，便于比较
+		ChatGrpcClient::GetInstance()->GetLatency().Register("notify_grpc");
+		RedisBus::GetInstance()->GetLatency().Register("notify_bus");
+		stats->Start(io_context);
+		//Transport = redis时订阅本服务器的通知频道
+		RedisBus::GetInstance()->Start();
+		//订阅用户信息变更，失效本地缓存
+		UserCache::GetInstance()->Start();
+		//在线数增量定时写入redis
+		OnlineCounter::GetInstance()->Start(io_context);
 		io_context.run();
 	}
 	catch (const std::exception& e)
@@ -6,6 +6,8 @@
 #include <json/reader.h>
 #include "RedisMgr.h"
 #include "MysqlMgr.h"
+#include "JsonWriter.h"
+#include "UserCache.h"
 
 ChatServiceImpl::ChatServiceImpl()
 {
@@ -34,9 +36,7 @@ Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendR
         rtvalue["sex"] = request->sex();
         rtvalue["nick"] = request->nick();
 
-        std::string return_str = rtvalue.toStyledString();
-
-        session->Send(return_str, ID_NOTIFY_ADD_FRIEND_REQ);
+        session->SendMsg(rtvalue, ID_NOTIFY_ADD_FRIEND_REQ);
         return Status::OK;
 }
 Status ChatServiceImpl::NotifyAuthFriend(ServerContext* context,
@@ -76,9 +76,7 @@ Status ChatServiceImpl::NotifyAuthFriend(ServerContext* context,
 		rtvalue["error"] = ErrorCodes::UidInvalid;
 	}
 
-	std::string return_str = rtvalue.toStyledString();
-
-	session->Send(return_str, ID_NOTIFY_AUTH_FRIEND_REQ);
+	session->SendMsg(rtvalue, ID_NOTIFY_AUTH_FRIEND_REQ);
 	return Status::OK;
 }
 Status ChatServiceImpl::NotifyTextChatMsg(::grpc::ServerContext* context,
@@ -105,52 +103,10 @@ Status ChatServiceImpl::NotifyTextChatMsg(::grpc::ServerContext* context,
 		text_array.append(element);
 	}
 	rtvalue["text_array"] = text_array;
-	std::string return_str = rtvalue.toStyledString();
-	session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ); 
+	session->SendMsg(rtvalue, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
     return Status::OK;
 }
 bool ChatServiceImpl::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo) {
-	//ȲredisвѯûϢ
-	std::string info_str = "";
-	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
-	if (b_base) {
-		Json::Reader reader;
-		Json::Value root;
-		reader.parse(info_str, root);
-		userinfo->uid = root["uid"].asInt();
-		userinfo->name = root["name"].asString();
-		userinfo->pwd = root["pwd"].asString();
-		userinfo->email = root["email"].asString();
-		userinfo->nick = root["nick"].asString();
-		userinfo->desc = root["desc"].asString();
-		userinfo->sex = root["sex"].asInt();
-		userinfo->icon = root["icon"].asString();
-		std::cout << "user login uid is  " << userinfo->uid << " name  is "
-			<< userinfo->name << " pwd is " << userinfo->pwd << " email is " << userinfo->email << endl;
-	}
-	else {
-		//redisûѯmysql
-		//ѯݿ
-		std::shared_ptr<UserInfo> user_info = nullptr;
-		user_info = MysqlMgr::GetInstance()->GetUser(uid);
-		if (user_info == nullptr) {
-			return false;
-		}
-
-		userinfo = user_info;
-
-		//ݿдredis
-		Json::Value redis_root;
-		redis_root["uid"] = uid;
-		redis_root["pwd"] = userinfo->pwd;
-		redis_root["name"] = userinfo->name;
-		redis_root["email"] = userinfo->email;
-		redis_root["nick"] = userinfo->nick;
-		redis_root["desc"] = userinfo->desc;
-		redis_root["sex"] = userinfo->sex;
-		redis_root["icon"] = userinfo->icon;
-		RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
-	}
-
-	return true;
+	//β鱾ػ桢redismysql
+	return UserCache::GetInstance()->GetBaseInfo(uid, userinfo);
 }
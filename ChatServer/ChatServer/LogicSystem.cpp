@@ -2,59 +2,59 @@
 #include "RedisMgr.h"
 #include "MysqlMgr.h"
 #include "ConfigMgr.h"
-#include "UserMgr.h"'
+#include "UserMgr.h"
 #include "ChatGrpcClient.h"
-LogicSystem::LogicSystem():_b_stop(false)
+#include "MsgCodec.h"
+#include "JsonWriter.h"
+#include "AsyncRedis.h"
+#include "OnlineCounter.h"
+#include "RedisBus.h"
+#include "UserCache.h"
+LogicSystem::LogicSystem()
 {
 	RegisterCallBacks();
-	_worker_thread = std::thread(&LogicSystem::DealMsg,this);
+	auto& cfg = ConfigMgr::Inst();
+	auto worker_str = cfg["LogicSystem"]["WorkerNum"];
+	std::size_t worker_num = worker_str.empty() ? 0 : std::stoul(worker_str);
+	if (worker_num == 0) {
+		worker_num = std::max(1u, std::thread::hardware_concurrency());
+	}
+	for (std::size_t i = 0; i < worker_num; ++i) {
+		_workers.emplace_back(std::make_unique<LogicWorker>(
+			std::bind(&LogicSystem::DealMsg, this, placeholders::_1)));
+	}
+	std::cout << "LogicSystem start " << worker_num << " workers" << std::endl;
 }
 
-void LogicSystem::DealMsg()
+void LogicSystem::DealMsg(const std::unique_ptr<LogicNode>& msg_node)
 {
-	for (;;) {
-		std::unique_lock<std::mutex> unique_lk(_mutex);
-		//ж϶Ϊȴͷ
-		while (_msg_que.empty() && !_b_stop) {
-			_consume.wait(unique_lk);
-		}
-
-		//жǷΪر״̬߼ִ˳ѭ
-		if (_b_stop) {
-			while (!_msg_que.empty()) {
-				auto msg_node = _msg_que.front();
-				cout << "recv_msg id  is " << msg_node->_recvnode->_msg_id << endl;
-				auto call_back_iter = _fun_callback.find(msg_node->_recvnode->_msg_id);
-				if (call_back_iter == _fun_callback.end()) {
-					_msg_que.pop();
-					continue;
-				}
-				call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id,
-					std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-				_msg_que.pop();
-			}
-			break;
-		}
-
-		//ûͣ˵
-		auto msg_node = _msg_que.front();
-		cout << "recv_msg id  is " << msg_node->_recvnode->_msg_id << endl;
-		auto call_back_iter = _fun_callback.find(msg_node->_recvnode->_msg_id);
-		if (call_back_iter == _fun_callback.end()) {
-			_msg_que.pop();
-			std::cout << "msg id [" << msg_node->_recvnode->_msg_id << "] handler not found" << std::endl;
-			continue;
-		}
-		call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id,
-			std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-		_msg_que.pop();
+	cout << "recv_msg id  is " << msg_node->_recvnode->_msg_id << endl;
+	auto call_back_iter = _fun_callback.find(msg_node->_recvnode->_msg_id);
+	if (call_back_iter == _fun_callback.end()) {
+		std::cout << "msg id [" << msg_node->_recvnode->_msg_id << "] handler not found" << std::endl;
+		return;
 	}
+	//ỰЭ̵Э룬ֱӴӽջٿstd::string
+	Json::Value root;
+	if (!MsgCodec::GetInstance()->Decode(msg_node->_session->GetCodec(), msg_node->_recvnode->_msg_id,
+		std::string_view(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len), root)) {
+		std::cout << "msg id [" << msg_node->_recvnode->_msg_id << "] decode failed" << std::endl;
+		return;
+	}
+	call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id, root);
+}
+
+std::size_t LogicSystem::GetWorkerIndex(shared_ptr<CSession> session)
+{
+	//ӵϢsession idƬ¼ǰͬһworker¼֮ǰ󲻻ᱻworkerִ
+	return static_cast<std::size_t>(session->GetSessionId() % _workers.size());
 }
 
 LogicSystem::~LogicSystem() {
-	_b_stop = true;
-	_consume.notify_one();
-	_worker_thread.join();
+	//ֹͣworkerֹͣǰᴦʣϢ
+	for (auto& worker : _workers) {
+		worker->Stop();
+	}
 }
 
 void LogicSystem::RegisterCallBacks()
@@ -67,79 +67,65 @@ void LogicSystem::RegisterCallBacks()
 		placeholders::_1, placeholders::_2, placeholders::_3);
 	_fun_callback[ID_AUTH_FRIEND_REQ] = std::bind(&LogicSystem::AuthFriendApply, this,
 		placeholders::_1, placeholders::_2, placeholders::_3);
+	_fun_callback[ID_TEXT_CHAT_MSG_REQ] = std::bind(&LogicSystem::DealChatTextMsg, this,
+		placeholders::_1, placeholders::_2, placeholders::_3);
 }
 
 bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo)
 {
-	//ȲredisвѯûϢ
-	std::string info_str = "";
-	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
-	if (b_base) {
-		Json::Reader reader;
-		Json::Value root;
-		reader.parse(info_str, root);
-		userinfo->uid = root["uid"].asInt();
-		userinfo->name = root["name"].asString();
-		userinfo->pwd = root["pwd"].asString();
-		userinfo->email = root["email"].asString();
-		userinfo->nick = root["nick"].asString();
-		userinfo->desc = root["desc"].asString();
-		userinfo->sex = root["sex"].asInt();
-		userinfo->icon = root["icon"].asString();
-		std::cout << "user login uid is  " << userinfo->uid << " name  is "
-			<< userinfo->name << " pwd is " << userinfo->pwd << " email is " << userinfo->email << endl;
-	}
-	else {
-		//redisûѯmysql
-		//ѯݿ
-		std::shared_ptr<UserInfo> user_info = nullptr;
-		user_info = MysqlMgr::GetInstance()->GetUser(uid);
-		if (user_info == nullptr) {
-			return false;
-		}
-
-		userinfo = user_info;
-
-		//ݿдredis
-		Json::Value redis_root;
-		redis_root["uid"] = uid;
-		redis_root["pwd"] = userinfo->pwd;
-		redis_root["name"] = userinfo->name;
-		redis_root["email"] = userinfo->email;
-		redis_root["nick"] = userinfo->nick;
-		redis_root["desc"] = userinfo->desc;
-		redis_root["sex"] = userinfo->sex;
-		redis_root["icon"] = userinfo->icon;
-		RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
-	}
-
-	return true;
+	//β鱾ػ桢redismysql
+	return UserCache::GetInstance()->GetBaseInfo(uid, userinfo);
 }
 
-void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short& msg_id, const string& msg_data)
+void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short& msg_id, const Json::Value& root)
 {
-	Json::Reader reader;
-	Json::Value root;
-	reader.parse(msg_data, root);
 	auto uid = root["uid"].asInt();
 	auto token = root["token"].asString();
+	//ͻЭ飬¼ɹЧ
+	auto codec = MsgCodec::ParseCodecName(root["codec"].asString());
+	//ͻ֧deflateʹչͷʱѹ¼ذͿѹ
+	bool b_compress = root["compress"].asString() == "deflate" && session->IsExtHead();
 	std::cout << "user login uid is " << root["uid"].asInt() << "user token is " << root["token"].asString() << std::endl;
 
-	std::string rturn_str = root.toStyledString();
-
 	Json::Value rtvalue;
-	Defer defer([this, &rtvalue, session]() {
-		std::string return_str = rtvalue.toStyledString();
-		std::cout << "user login uid is " <<return_str<< std::endl;
-		session->Send(return_str, MSG_CHAT_LOGIN_RSP);
+	long long offline_len = 0;
+	Defer defer([this, &rtvalue, &offline_len, session, uid, codec, b_compress]() {
+		//¼ذ̶jsonͻ˾ݴȷЭ飬֮ϢЭ̵Эշ
+		if (rtvalue["error"].asInt() == ErrorCodes::Success) {
+			rtvalue["codec"] = MsgCodec::GetCodecName(codec);
+			session->SetCodec(codec);
+			if (b_compress) {
+				rtvalue["compress"] = "deflate";
+				session->SetCompress(true);
+			}
+		}
+		std::cout << "user login uid is " << rtvalue["uid"].asInt() << " error is " << rtvalue["error"].asInt() << std::endl;
+		session->SendMsg(rtvalue, MSG_CHAT_LOGIN_RSP, CODEC_JSON);
+		//Ϣڵ¼ذ֮
+		if (rtvalue["error"].asInt() == ErrorCodes::Success && offline_len > 0) {
+			DrainOfflineMsg(session, uid);
+		}
 		});
 
-	//redisȡûtokenǷȷ
+	//ػʱֻtokentokenͻϢһˮ߶ֻһ
+	//˳ȡ߶гȣûϢʱٶһ
 	std::string uid_str = std::to_string(uid);
 	std::string token_key= USERTOKENPREFIX + uid_str;
+	std::string base_key = USER_BASE_INFO + uid_str;
+	std::string offline_key = OFFLINE_MSG_PREFIX + uid_str;
+	std::shared_ptr<UserInfo> user_info;
+	//пĿʱȻredistokenЧ˵ûܸע
+	bool b_cached = UserCache::GetInstance()->Get(uid, user_info) && user_info != nullptr;
+	//ڶredis֮ǰȡ汾ţڼ䱻ʧЧʱֵ
+	auto cache_version = UserCache::GetInstance()->GetVersion(uid);
+	std::vector<RedisCmd> cmds = { { "GET", token_key }, { "LLEN", offline_key } };
+	if (!b_cached) {
+		cmds.push_back({ "GET", base_key });
+	}
+	std::vector<RedisReplyPtr> replies;
+	bool success = RedisMgr::GetInstance()->Pipeline(cmds, replies);
 	std::string token_value = "";
-	bool success = RedisMgr::GetInstance()->Get(token_key, token_value);
-	if (!success) {
+	if (!success || !RedisMgr::ReplyToString(replies[0].get(), token_value)) {
 		rtvalue["error"] = ErrorCodes::UidInvalid;
 		return;
 	}
@@ -148,13 +134,19 @@ void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short& msg_id
 		return;
 	}
 	rtvalue["error"] = ErrorCodes::Success;
+	if (replies[1] != nullptr && replies[1]->type == REDIS_REPLY_INTEGER) {
+		offline_len = replies[1]->integer;
+	}
 
-	std::string base_key = USER_BASE_INFO + uid_str;
-	auto user_info = std::make_shared<UserInfo>();
-	bool b_base = GetBaseInfo(base_key, uid, user_info);
-	if (!b_base) {
-		rtvalue["error"] = ErrorCodes::UidInvalid;
-		return;
+	if (!b_cached) {
+		std::string_view info_str;
+		if (RedisMgr::ReplyToView(replies[2].get(), info_str)) {
+			UserCache::GetInstance()->ParseBaseInfo(uid, info_str, user_info, cache_version);
+		}
+		else if (!UserCache::GetInstance()->LoadBaseInfo(uid, user_info)) {
+			rtvalue["error"] = ErrorCodes::UidInvalid;
+			return;
+		}
 	}
 	rtvalue["uid"] = uid;
 	rtvalue["pwd"] = user_info->pwd;
@@ -195,40 +187,53 @@ void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short& msg_id
 			obj["back"] = friend_ele->back;
 			rtvalue["friend_list"].append(obj);
 		}
-	auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
-	//¼
-	auto rd_res = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, server_name);
-	int count = 0;
-	if (!rd_res.empty()) {
-		count = std::stoi(rd_res);
+	//ӣOnlineCounterϲдredis
+	if (session->MarkLogin()) {
+		OnlineCounter::GetInstance()->Incr();
 	}
-	count++;
-
-	auto count_str = std::to_string(count);
-	RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, count_str);
+	auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
 	//sessionûuid
 	session->SetUserId(uid);
-	//Ϊûõ¼ip server
+	//Ϊûõ¼ip server֣д벻ҪȽ첽
 	std::string  ipkey = USERIPPREFIX + uid_str;
-	RedisMgr::GetInstance()->Set(ipkey, server_name);
+	AsyncRedis::GetInstance()->Command({ "SET", ipkey, server_name });
 	//uidsession󶨹,Ժ˲
 	UserMgr::GetInstance()->SetUserSession(uid, session);
 	std::string  uid_session_key = USER_SESSION_PREFIX + uid_str;
-	RedisMgr::GetInstance()->Set(uid_session_key, session->GetSessionId());
+	AsyncRedis::GetInstance()->Command({ "SET", uid_session_key, std::to_string(session->GetSessionId()) });
 }
 
-void LogicSystem::SearchInfo(shared_ptr<CSession> session, const short& msg_id, const string& msg_data)
+void LogicSystem::DrainOfflineMsg(shared_ptr<CSession> session, int uid)
+{
+	//ȡɾһУڼתϢ´ε¼
+	std::string offline_key = OFFLINE_MSG_PREFIX + std::to_string(uid);
+	std::vector<RedisReplyPtr> replies;
+	if (!RedisMgr::GetInstance()->Transaction({
+		{ "LRANGE", offline_key, "0", "-1" },
+		{ "DEL", offline_key } }, replies)) {
+		return;
+	}
+	auto list = replies[0].get();
+	if (list == nullptr || list->type != REDIS_REPLY_ARRAY) {
+		return;
+	}
+	std::cout << "user " << uid << " drain offline msg count is " << list->elements << std::endl;
+	for (size_t i = 0; i < list->elements; ++i) {
+		std::string_view record;
+		if (RedisMgr::ReplyToView(list->element[i], record)) {
+			session->ReplaySpilled(record);
+		}
+	}
+}
+
+void LogicSystem::SearchInfo(shared_ptr<CSession> session, const short& msg_id, const Json::Value& root)
 {
-	Json::Reader reader;
-	Json::Value root;
-	reader.parse(msg_data, root);
 	auto uid_str = root["uid"].asString();
 	std::cout << "user searchinfo uid is " << uid_str << std::endl;
 
 	Json::Value rtvalue;
 	Defer deder([this, &rtvalue, session]() {
-		std::string return_str = rtvalue.toStyledString();
-		session->Send(return_str, ID_SEARCH_USER_RSP);
+		session->SendMsg(rtvalue, ID_SEARCH_USER_RSP);
 		});
 	bool b_digit = isPureDigit(uid_str);
 	if (b_digit) {
@@ -238,11 +243,8 @@ void LogicSystem::SearchInfo(shared_ptr<CSession> session, const short& msg_id,
 	}
 }
 
-void LogicSystem::AddFriendApply(shared_ptr<CSession> session, const short& msg_id, const string& msg_data)
+void LogicSystem::AddFriendApply(shared_ptr<CSession> session, const short& msg_id, const Json::Value& root)
 {
-	Json::Reader reader;
-	Json::Value root;
-	reader.parse(msg_data, root);
 	auto  uid = root["uid"].asInt();
 	auto applyname = root["applyname"].asString();
 	auto bakname = root["bakname"].asString();
@@ -253,8 +255,7 @@ void LogicSystem::AddFriendApply(shared_ptr<CSession> session, const short& msg_
 	Json::Value rtvalue;
 	rtvalue["error"] = ErrorCodes::Success;
 	Defer defer([this, &rtvalue, session]() {
-		std::string return_str = rtvalue.toStyledString();
-		session->Send(return_str, ID_ADD_FRIEND_RSP);
+		session->SendMsg(rtvalue, ID_ADD_FRIEND_RSP);
 		});
 
 	MysqlMgr::GetInstance()->AddFriendApply(uid, touid);
@@ -291,8 +292,7 @@ void LogicSystem::AddFriendApply(shared_ptr<CSession> session, const short& msg_
 				notify["sex"] = apply_info->sex;
 				notify["nick"] = apply_info->nick;
 			}
-			std::string return_str = notify.toStyledString();
-			session->Send(return_str, ID_NOTIFY_ADD_FRIEND_REQ);
+			session->SendMsg(notify, ID_NOTIFY_ADD_FRIEND_REQ);
 		}
 
 		return;
@@ -311,16 +311,16 @@ void LogicSystem::AddFriendApply(shared_ptr<CSession> session, const short& msg_
 	}
 
 	//֪ͨ
+	if (RedisBus::GetInstance()->IsEnabled()) {
+		RedisBus::GetInstance()->Publish(to_ip_value, BUS_ADD_FRIEND, add_req);
+		return;
+	}
 	ChatGrpcClient::GetInstance()->NotifyAddFriend(to_ip_value, add_req);
 
 }
 
-void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data)
+void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const Json::Value& root)
 {
-	Json::Reader reader;
-	Json::Value root;
-	reader.parse(msg_data, root);
-
 	auto uid = root["fromuid"].asInt();
 	auto touid = root["touid"].asInt();
 	auto back_name = root["back"].asString();
@@ -345,8 +345,7 @@ void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short
 
 
 	Defer defer([this, &rtvalue, session]() {
-		std::string return_str = rtvalue.toStyledString();
-		session->Send(return_str, ID_AUTH_FRIEND_RSP);
+		session->SendMsg(rtvalue, ID_AUTH_FRIEND_RSP);
 		});
 
 
@@ -387,8 +386,7 @@ void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short
 			}
 
 
-			std::string return_str = notify.toStyledString();
-			session->Send(return_str, ID_NOTIFY_AUTH_FRIEND_REQ);
+			session->SendMsg(notify, ID_NOTIFY_AUTH_FRIEND_REQ);
 		}
 
 		return;
@@ -400,6 +398,10 @@ void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short
 	auth_req.set_touid(touid);
 
 	//֪ͨ
+	if (RedisBus::GetInstance()->IsEnabled()) {
+		RedisBus::GetInstance()->Publish(to_ip_value, BUS_AUTH_FRIEND, auth_req);
+		return;
+	}
 	ChatGrpcClient::GetInstance()->NotifyAuthFriend(to_ip_value, auth_req);
 }
 
@@ -416,60 +418,14 @@ bool LogicSystem::isPureDigit(const std::string& str)
 void LogicSystem::GetUserByUid(std::string uid_str, Json::Value& rtvalue)
 {
 	rtvalue["error"] = ErrorCodes::Success;
-	std::string base_key = USER_BASE_INFO + uid_str;
-
-	//ȲredisвѯûϢ
-	std::string info_str = "";
-	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
-	if (b_base) {
-		Json::Reader reader;
-		Json::Value root;
-		reader.parse(info_str, root);
-		auto uid = root["uid"].asInt();
-		auto name = root["name"].asString();
-		auto pwd = root["pwd"].asString();
-		auto email = root["email"].asString();
-		auto nick = root["nick"].asString();
-		auto desc = root["desc"].asString();
-		auto sex = root["sex"].asInt();
-		auto icon = root["icon"].asString();
-		std::cout << "user  uid is  " << uid << " name  is "
-			<< name << " pwd is " << pwd << " email is " << email << " icon is " << icon << endl;
-
-		rtvalue["uid"] = uid;
-		rtvalue["pwd"] = pwd;
-		rtvalue["name"] = name;
-		rtvalue["email"] = email;
-		rtvalue["nick"] = nick;
-		rtvalue["desc"] = desc;
-		rtvalue["sex"] = sex;
-		rtvalue["icon"] = icon;
-		return;
-	}
-
 	auto uid = std::stoi(uid_str);
-	//redisûѯmysql
-	//ѯݿ
-	std::shared_ptr<UserInfo> user_info = nullptr;
-	user_info = MysqlMgr::GetInstance()->GetUser(uid);
-	if (user_info == nullptr) {
+	//β鱾ػ桢redismysql
+	std::shared_ptr<UserInfo> user_info;
+	if (!UserCache::GetInstance()->GetBaseInfo(uid, user_info)) {
 		rtvalue["error"] = ErrorCodes::UidInvalid;
 		return;
 	}
 
-	//ݿдredis
-	Json::Value redis_root;
-	redis_root["uid"] = user_info->uid;
-	redis_root["pwd"] = user_info->pwd;
-	redis_root["name"] = user_info->name;
-	redis_root["email"] = user_info->email;
-	redis_root["nick"] = user_info->nick;
-	redis_root["desc"] = user_info->desc;
-	redis_root["sex"] = user_info->sex;
-	redis_root["icon"] = user_info->icon;
-
-	RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
-
 	//
 	rtvalue["uid"] = user_info->uid;
 	rtvalue["pwd"] = user_info->pwd;
@@ -533,7 +489,7 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 	redis_root["desc"] = user_info->desc;
 	redis_root["sex"] = user_info->sex;
 
-	RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
+	RedisMgr::GetInstance()->Set(base_key, JsonWriter::Write(redis_root));
 
 	//
 	rtvalue["uid"] = user_info->uid;
@@ -557,11 +513,8 @@ bool LogicSystem::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInf
 	return MysqlMgr::GetInstance()->GetFriendList(self_id, user_list);
 }
 
-void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data)
+void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, const Json::Value& root)
 {
-	Json::Reader reader;
-	Json::Value root;
-	reader.parse(msg_data, root);
 
 	auto uid = root["fromuid"].asInt();
 	auto touid = root["touid"].asInt();
@@ -574,8 +527,7 @@ void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short
 	rtvalue["fromuid"] = uid;
 	rtvalue["touid"] = touid;
 	Defer defer([this, &rtvalue, session]() {
-		std::string return_str = rtvalue.toStyledString();
-		session->Send(return_str, ID_TEXT_CHAT_MSG_RSP);
+		session->SendMsg(rtvalue, ID_TEXT_CHAT_MSG_RSP);
 		});
 	//ѯredis touidӦserver ip
 	auto to_str = std::to_string(touid);
@@ -593,8 +545,7 @@ void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short
 		if (session)
 		{
 			//ڴֱӷ֪ͨԷ
-			std::string return_str = rtvalue.toStyledString();
-			session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
+			session->SendMsg(rtvalue, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
 		}
 		return; 
 	}
@@ -612,16 +563,16 @@ void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short
 	}
 
 	//֪ͨ
+	if (RedisBus::GetInstance()->IsEnabled()) {
+		RedisBus::GetInstance()->Publish(to_ip_value, BUS_TEXT_CHAT, text_msg_req);
+		return;
+	}
 	ChatGrpcClient::GetInstance()->NotifyTextChatMsg(to_ip_value, text_msg_req, rtvalue);
 }
 
 
-void LogicSystem::PostMsgToQue(shared_ptr<LogicNode> msg)
+void LogicSystem::PostMsgToQue(std::unique_ptr<LogicNode> msg)
 {
-	std::unique_lock<std::mutex> unique_lk(_mutex);
-	_msg_que.push(msg);
-	if (_msg_que.size() == 1) {
-		unique_lk.unlock();
-		_consume.notify_one();
-	}
+	auto index = GetWorkerIndex(msg->_session);
+	_workers[index]->PostMsgToQue(std::move(msg));
 }
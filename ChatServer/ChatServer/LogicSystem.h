@@ -11,38 +11,39 @@
 #include <json/value.h>
 #include <json/reader.h>
 #include <unordered_map>
+#include <string_view>
 #include "MysqlDao.h"
 #include "data.h"
+#include "LogicWorker.h"
 
 class CServer;
-typedef  function<void(shared_ptr<CSession>, const short& msg_id, const string& msg_data)> FunCallBack;
+typedef  function<void(shared_ptr<CSession>, const short& msg_id, const Json::Value& root)> FunCallBack;
 class LogicSystem:public Singleton<LogicSystem>
 {
 	friend class Singleton<LogicSystem>;
 public:
 	~LogicSystem();
-	void PostMsgToQue(shared_ptr<LogicNode> msg);
+	void PostMsgToQue(std::unique_ptr<LogicNode> msg);
 private:
 	LogicSystem();
-	void DealMsg();
+	void DealMsg(const std::unique_ptr<LogicNode>& msg_node);
+	std::size_t GetWorkerIndex(shared_ptr<CSession> session);
 	void RegisterCallBacks();
 	bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo);
-	void LoginHandler(shared_ptr<CSession>, const short& msg_id, const string& msg_data);
-	void SearchInfo(shared_ptr<CSession>, const short& msg_id, const string& msg_data);
-	void AddFriendApply(shared_ptr<CSession>, const short& msg_id, const string& msg_data);
-	void AuthFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
+	void LoginHandler(shared_ptr<CSession>, const short& msg_id, const Json::Value& root);
+	//¼ѷͶлѹʱתϢȡ·
+	void DrainOfflineMsg(shared_ptr<CSession> session, int uid);
+	void SearchInfo(shared_ptr<CSession>, const short& msg_id, const Json::Value& root);
+	void AddFriendApply(shared_ptr<CSession>, const short& msg_id, const Json::Value& root);
+	void AuthFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const Json::Value& root);
 	bool isPureDigit(const std::string& str);
 	void GetUserByUid(std::string uid_str, Json::Value& rtvalue);
 	void GetUserByName(std::string name, Json::Value& rtvalue);
 	bool GetFriendApplyInfo(int to_uid, std::vector<std::shared_ptr<ApplyInfo>>& list);
 	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>>& user_list);
-	void DealChatTextMsg(std::shared_ptr<CSession> session,const short&msg_id,const string& msg_data);
-	std::thread _worker_thread;
-	std::queue<shared_ptr<LogicNode>> _msg_que;
-	std::mutex _mutex;
-	std::condition_variable _consume;
-	bool _b_stop;
+	void DealChatTextMsg(std::shared_ptr<CSession> session,const short&msg_id,const Json::Value& root);
+	//uidƬ߼߳
+	std::vector<std::unique_ptr<LogicWorker>> _workers;
 	std::map<short, FunCallBack> _fun_callback;
-	std::unordered_map<int, std::shared_ptr<UserInfo>> _users;
 };
 
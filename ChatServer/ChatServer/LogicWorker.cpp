@@ -0,0 +1,44 @@
+#include "LogicWorker.h"
+
+LogicWorker::LogicWorker(LogicHandler handler) :_handler(handler), _msg_que(MAX_RECVQUE), _b_stop(false)
+{
+	_worker_thread = std::thread(&LogicWorker::DealMsg, this);
+}
+
+LogicWorker::~LogicWorker()
+{
+	Stop();
+}
+
+void LogicWorker::PostMsgToQue(std::unique_ptr<LogicNode> msg)
+{
+	//ʱȴڳλã൱ڶio߳ѹ
+	_msg_que.Push(msg);
+}
+
+void LogicWorker::Stop()
+{
+	if (_b_stop.exchange(true)) {
+		return;
+	}
+	_msg_que.Stop();
+	if (_worker_thread.joinable()) {
+		_worker_thread.join();
+	}
+}
+
+void LogicWorker::DealMsg()
+{
+	std::vector<std::unique_ptr<LogicNode>> batch;
+	batch.reserve(LOGIC_BATCH_SIZE);
+	for (;;) {
+		//ΪʱPopBatchߣرպʣϢŷ0
+		batch.clear();
+		if (_msg_que.PopBatch(batch, LOGIC_BATCH_SIZE) == 0) {
+			break;
+		}
+		for (auto& msg_node : batch) {
+			_handler(msg_node);
+		}
+	}
+}
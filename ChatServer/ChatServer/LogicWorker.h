@@ -0,0 +1,28 @@
+#pragma once
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include "CSession.h"
+#include "MpscQueue.h"
+
+typedef std::function<void(const std::unique_ptr<LogicNode>&)> LogicHandler;
+//߼̣߳ռһϢУͬһӵϢͶݵͬһworker֤Ϣ
+class LogicWorker
+{
+public:
+	LogicWorker(LogicHandler handler);
+	~LogicWorker();
+	LogicWorker(const LogicWorker&) = delete;
+	LogicWorker& operator=(const LogicWorker&) = delete;
+	void PostMsgToQue(std::unique_ptr<LogicNode> msg);
+	void Stop();
+private:
+	void DealMsg();
+	LogicHandler _handler;
+	std::thread _worker_thread;
+	BlockingMpscQueue<std::unique_ptr<LogicNode>> _msg_que;
+	std::atomic<bool> _b_stop;
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include "const.h"
+#include "singleton.h"
+#include <map>
+#include <string_view>
+#include <google/protobuf/message.h>
+
+//ͻϢ
+//jsonЭֱӽıprotobufЭ鰴ϢidҵӦϢͣͨJson::Valueת
+//ıƵϢעͻת߷䡣߼ĴЭ鿴ĶJson::Value
+class MsgCodec :public Singleton<MsgCodec>
+{
+	friend class Singleton<MsgCodec>;
+public:
+	~MsgCodec();
+	bool Decode(int codec, short msg_id, std::string_view data, Json::Value& root);
+	bool Encode(int codec, short msg_id, const Json::Value& root, std::string& data);
+	//¼codecֶЭ͵Ļת
+	static int ParseCodecName(const std::string& name);
+	static std::string GetCodecName(int codec);
+private:
+	MsgCodec();
+	void RegMsg(short msg_id, const google::protobuf::Message& prototype);
+	void ProtoToJson(const google::protobuf::Message& msg, Json::Value& root);
+	void JsonToProto(const Json::Value& root, google::protobuf::Message* msg);
+	typedef bool (*DecodeFun)(std::string_view data, Json::Value& root);
+	typedef bool (*EncodeFun)(const Json::Value& root, std::string& data);
+	//ϢidprotobufϢ͵ӳ䣬ֻڹʱд
+	std::map<short, const google::protobuf::Message*> _prototypes;
+	//ƵϢͻתڷ
+	std::map<short, DecodeFun> _decoders;
+	std::map<short, EncodeFun> _encoders;
+};
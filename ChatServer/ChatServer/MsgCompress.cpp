@@ -0,0 +1,169 @@
+#include "MsgCompress.h"
+#include <zlib.h>
+
+std::atomic<int64_t> MsgCompress::_raw_bytes(0);
+std::atomic<int64_t> MsgCompress::_compressed_bytes(0);
+
+namespace {
+	//Ԥֵ䣬¼ذ֪ͨıϢгֶԽõķԽ
+	const char kDictionary[] =
+		"\"email\":\"\",\"pwd\":\"\",\"codec\":\"json\",\"compress\":\"deflate\","
+		"\"applyname\":\"\",\"bakname\":\"\",\"applyuid\":,\"status\":0,\"back\":\"\","
+		"{\"error\":0,\"uid\":,\"name\":\"\",\"nick\":\"\",\"icon\":\"\",\"desc\":\"\",\"sex\":0,"
+		"\"apply_list\":[{\"uid\":,\"name\":\"\",\"nick\":\"\",\"icon\":\"\",\"desc\":\"\",\"sex\":0,\"status\":0}],"
+		"\"friend_list\":[{\"uid\":,\"name\":\"\",\"nick\":\"\",\"icon\":\"\",\"desc\":\"\",\"sex\":0,\"back\":\"\"}],"
+		"{\"error\":0,\"fromuid\":,\"touid\":,\"text_array\":[{\"content\":\"\",\"msgid\":\"\"}]}";
+
+	struct DeflateStream {
+		z_stream stream;
+		bool b_init;
+		DeflateStream() :b_init(false) {
+			memset(&stream, 0, sizeof(stream));
+			b_init = deflateInit(&stream, Z_DEFAULT_COMPRESSION) == Z_OK;
+		}
+		~DeflateStream() {
+			if (b_init) {
+				deflateEnd(&stream);
+			}
+		}
+	};
+
+	struct InflateStream {
+		z_stream stream;
+		bool b_init;
+		InflateStream() :b_init(false) {
+			memset(&stream, 0, sizeof(stream));
+			b_init = inflateInit(&stream) == Z_OK;
+		}
+		~InflateStream() {
+			if (b_init) {
+				inflateEnd(&stream);
+			}
+		}
+	};
+
+	//ÿ̸߳һѹ
+	InflateStream& GetInflateStream() {
+		thread_local InflateStream inflate_stream;
+		return inflate_stream;
+	}
+
+	//ѹoutʼcapacityֽУռʱgrowݣݺѽѹҪ
+	//ѹ󳬹max_lenΪǷ
+	template <typename Grow>
+	bool Inflate(const char* data, std::size_t len, std::size_t max_len, char* out, std::size_t capacity,
+		std::size_t& out_len, Grow grow) {
+		auto& inflate_stream = GetInflateStream();
+		if (!inflate_stream.b_init) {
+			return false;
+		}
+		auto& stream = inflate_stream.stream;
+		if (inflateReset(&stream) != Z_OK) {
+			return false;
+		}
+
+		stream.next_in = (Bytef*)data;
+		stream.avail_in = (uInt)len;
+		while (true) {
+			std::size_t usable = (std::min)(capacity, max_len);
+			stream.next_out = (Bytef*)out + stream.total_out;
+			stream.avail_out = (uInt)(usable - stream.total_out);
+			int ret = inflate(&stream, Z_NO_FLUSH);
+			if (ret == Z_NEED_DICT) {
+				if (inflateSetDictionary(&stream, (const Bytef*)kDictionary, sizeof(kDictionary) - 1) != Z_OK) {
+					return false;
+				}
+				continue;
+			}
+			if (ret == Z_STREAM_END) {
+				break;
+			}
+			if (ret != Z_OK && ret != Z_BUF_ERROR) {
+				return false;
+			}
+			//ռ꣬ݣmax_len
+			if (stream.avail_out == 0) {
+				if (usable >= max_len) {
+					return false;
+				}
+				grow((std::min)(usable * 2, max_len), (std::size_t)stream.total_out, out, capacity);
+				continue;
+			}
+			//Ѿ굫ѹûн
+			if (stream.avail_in == 0) {
+				return false;
+			}
+		}
+		out_len = stream.total_out;
+		return true;
+	}
+}
+
+bool MsgCompress::Compress(const char* data, std::size_t len, std::string& out)
+{
+	thread_local DeflateStream deflate_stream;
+	if (!deflate_stream.b_init) {
+		return false;
+	}
+	auto& stream = deflate_stream.stream;
+	//ÿϢѹúֵ
+	if (deflateReset(&stream) != Z_OK ||
+		deflateSetDictionary(&stream, (const Bytef*)kDictionary, sizeof(kDictionary) - 1) != Z_OK) {
+		return false;
+	}
+
+	out.resize(deflateBound(&stream, (uLong)len));
+	stream.next_in = (Bytef*)data;
+	stream.avail_in = (uInt)len;
+	stream.next_out = (Bytef*)&out[0];
+	stream.avail_out = (uInt)out.size();
+	if (deflate(&stream, Z_FINISH) != Z_STREAM_END) {
+		return false;
+	}
+	out.resize(stream.total_out);
+	_raw_bytes.fetch_add(len, std::memory_order_relaxed);
+	_compressed_bytes.fetch_add(out.size(), std::memory_order_relaxed);
+	return true;
+}
+
+bool MsgCompress::Decompress(const char* data, std::size_t len, std::string& out, std::size_t max_len)
+{
+	out.resize((std::min)(len * 4 + 256, max_len));
+	std::size_t out_len = 0;
+	bool b_success = Inflate(data, len, max_len, &out[0], out.size(), out_len,
+		[&out](std::size_t new_size, std::size_t, char*& new_out, std::size_t& new_capacity) {
+			out.resize(new_size);
+			new_out = &out[0];
+			new_capacity = out.size();
+		});
+	if (!b_success) {
+		return false;
+	}
+	out.resize(out_len);
+	return true;
+}
+
+bool MsgCompress::Decompress(const char* data, std::size_t len, boost::intrusive_ptr<RecvBuffer>& out,
+	std::size_t& out_len, std::size_t max_len)
+{
+	//ڴذ䣬ʵܱĴȫ
+	out = new RecvBuffer((std::min)(len * 4 + 256, max_len));
+	return Inflate(data, len, max_len, out->_data, out->_capacity, out_len,
+		[&out](std::size_t new_size, std::size_t used, char*& new_out, std::size_t& new_capacity) {
+			boost::intrusive_ptr<RecvBuffer> new_buf(new RecvBuffer(new_size));
+			memcpy(new_buf->_data, out->_data, used);
+			out = new_buf;
+			new_out = out->_data;
+			new_capacity = out->_capacity;
+		});
+}
+
+int64_t MsgCompress::GetRawBytes()
+{
+	return _raw_bytes.load(std::memory_order_relaxed);
+}
+
+int64_t MsgCompress::GetCompressedBytes()
+{
+	return _compressed_bytes.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,140 @@
+#include "MsgPool.h"
+#include "const.h"
+#include <mutex>
+#include <algorithm>
+
+namespace {
+	//С64, 256, 1K, 4K, 16K, 64K
+	const std::size_t kSizeClasses[] = { 64, 256, 1024, 1024 * 4, 1024 * 16, 1024 * 64 };
+	const int kClassCount = sizeof(kSizeClasses) / sizeof(kSizeClasses[0]);
+
+	//߳˳ʱ֮黹ڴֱͷ
+	thread_local bool t_cache_destroyed = false;
+
+	struct ThreadCache {
+		~ThreadCache() {
+			t_cache_destroyed = true;
+			for (auto& free_list : _free_lists) {
+				for (auto* block : free_list) {
+					delete[] block;
+				}
+			}
+		}
+		std::vector<char*> _free_lists[kClassCount];
+	};
+
+	ThreadCache& LocalCache() {
+		thread_local ThreadCache cache;
+		return cache;
+	}
+
+	//ȫתأio̷߳䡢߼߳ͷŵڴͨÿԼټ
+	struct CentralCache {
+		std::mutex _mutex;
+		std::vector<char*> _free_list;
+	};
+
+	CentralCache& GetCentralCache(int size_class) {
+		static CentralCache central[kClassCount];
+		return central[size_class];
+	}
+}
+
+std::atomic<uint64_t> MsgPool::_hit_count(0);
+std::atomic<uint64_t> MsgPool::_miss_count(0);
+
+int MsgPool::GetSizeClass(std::size_t len)
+{
+	for (int i = 0; i < kClassCount; ++i) {
+		if (len <= kSizeClasses[i]) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+char* MsgPool::Allocate(std::size_t len, std::size_t& capacity)
+{
+	int size_class = GetSizeClass(len);
+	//󼶱ֱϵͳ
+	if (size_class < 0) {
+		_miss_count.fetch_add(1, std::memory_order_relaxed);
+		capacity = len;
+		return new char[len];
+	}
+
+	capacity = kSizeClasses[size_class];
+	auto& free_list = LocalCache()._free_lists[size_class];
+	if (free_list.empty()) {
+		//߳ûпп飬ȫתȡһ
+		auto& central = GetCentralCache(size_class);
+		std::lock_guard<std::mutex> lock(central._mutex);
+		std::size_t count = std::min<std::size_t>(MSG_POOL_BATCH_COUNT, central._free_list.size());
+		free_list.insert(free_list.end(), central._free_list.end() - count, central._free_list.end());
+		central._free_list.resize(central._free_list.size() - count);
+	}
+	if (!free_list.empty()) {
+		char* block = free_list.back();
+		free_list.pop_back();
+		_hit_count.fetch_add(1, std::memory_order_relaxed);
+		return block;
+	}
+	_miss_count.fetch_add(1, std::memory_order_relaxed);
+	return new char[capacity];
+}
+
+void MsgPool::Deallocate(char* data, std::size_t capacity)
+{
+	if (data == nullptr) {
+		return;
+	}
+	int size_class = GetSizeClass(capacity);
+	if (size_class < 0 || kSizeClasses[size_class] != capacity || t_cache_destroyed) {
+		delete[] data;
+		return;
+	}
+	//黹ǰ̵߳Ŀʱһȫתع̸߳
+	auto& free_list = LocalCache()._free_lists[size_class];
+	if (free_list.size() >= MSG_POOL_CACHE_COUNT) {
+		auto& central = GetCentralCache(size_class);
+		std::lock_guard<std::mutex> lock(central._mutex);
+		std::size_t count = MSG_POOL_BATCH_COUNT;
+		//תҲ˾ֱͷţ޶ڻڴ
+		if (central._free_list.size() + count > MSG_POOL_CACHE_COUNT * 8) {
+			for (std::size_t i = 0; i < count; ++i) {
+				delete[] free_list[free_list.size() - 1 - i];
+			}
+		}
+		else {
+			central._free_list.insert(central._free_list.end(), free_list.end() - count, free_list.end());
+		}
+		free_list.resize(free_list.size() - count);
+	}
+	free_list.push_back(data);
+}
+
+void* MsgPool::AllocateObject(std::size_t size)
+{
+	std::size_t capacity = 0;
+	return Allocate(size, capacity);
+}
+
+void MsgPool::DeallocateObject(void* ptr, std::size_t size)
+{
+	std::size_t capacity = size;
+	int size_class = GetSizeClass(size);
+	if (size_class >= 0) {
+		capacity = kSizeClasses[size_class];
+	}
+	Deallocate(static_cast<char*>(ptr), capacity);
+}
+
+uint64_t MsgPool::GetHitCount()
+{
+	return _hit_count.load(std::memory_order_relaxed);
+}
+
+uint64_t MsgPool::GetMissCount()
+{
+	return _miss_count.load(std::memory_order_relaxed);
+}
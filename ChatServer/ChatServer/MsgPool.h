@@ -0,0 +1,37 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//Сּ̱߳ڴأϢڵշ
+//ÿ߳άԼĿ͹黹
+class MsgPool
+{
+public:
+	//صڴСΪlenȡļСͨcapacity
+	static char* Allocate(std::size_t len, std::size_t& capacity);
+	static void Deallocate(char* data, std::size_t capacity);
+	//С䣬operator new/deleteʹ
+	static void* AllocateObject(std::size_t size);
+	static void DeallocateObject(void* ptr, std::size_t size);
+	static uint64_t GetHitCount();
+	static uint64_t GetMissCount();
+private:
+	static int GetSizeClass(std::size_t len);
+	static std::atomic<uint64_t> _hit_count;
+	static std::atomic<uint64_t> _miss_count;
+};
+
+//̳иĶͨMsgPool䣬ȫnew
+template <typename T>
+class PoolObject
+{
+public:
+	static void* operator new(std::size_t size) {
+		return MsgPool::AllocateObject(size);
+	}
+	static void operator delete(void* ptr, std::size_t size) {
+		MsgPool::DeallocateObject(ptr, size);
+	}
+};
@@ -315,8 +315,16 @@ bool MysqlDao::ConfirmFriendApply(const int& from, const int& to, const std::str
 
 std::shared_ptr<UserInfo> MysqlDao::GetUser(int uid)
 {
+    bool b_error = false;
+    return GetUser(uid, b_error);
+}
+
+std::shared_ptr<UserInfo> MysqlDao::GetUser(int uid, bool& b_error)
+{
+    b_error = false;
     auto con = pool_->getConnection();
     if (con == nullptr) {
+        b_error = true;
         return nullptr;
     }
 
@@ -351,6 +359,7 @@ std::shared_ptr<UserInfo> MysqlDao::GetUser(int uid)
         std::cerr << "SQLException: " << e.what();
         std::cerr << " (MySQL error code: " << e.getErrorCode();
         std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+        b_error = true;
         return nullptr;
     }
 }
@@ -40,6 +40,11 @@ std::shared_ptr<UserInfo> MysqlMgr::GetUser(int uid)
     return _dao.GetUser(uid);
 }
 
+std::shared_ptr<UserInfo> MysqlMgr::GetUser(int uid, bool& b_error)
+{
+    return _dao.GetUser(uid, b_error);
+}
+
 std::shared_ptr<UserInfo> MysqlMgr::GetUser(std::string name)
 {
     return _dao.GetUser(name);
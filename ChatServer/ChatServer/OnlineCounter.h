@@ -0,0 +1,35 @@
+#pragma once
+#include "const.h"
+#include "singleton.h"
+
+//дredislogincountϣйStatusServerؾ
+//¼ͶϿֻ޸ıʱHINCRBYϲдredis
+class OnlineCounter :public Singleton<OnlineCounter>
+{
+	friend class Singleton<OnlineCounter>;
+public:
+	~OnlineCounter();
+	void Incr();
+	void Decr();
+	//ǰ
+	int64_t GetOnline();
+	void Start(boost::asio::io_context& io_context);
+	//ͣʱͬдʣ֮Ҳֱͬд
+	void Stop();
+private:
+	OnlineCounter();
+	void StartTimer();
+	void Flush();
+	void FlushSync();
+	//ʱδѾֹͣʱϲÿֱд
+	void FlushIfNotMerging();
+	std::string _server_name;
+	std::atomic<int64_t> _online;
+	//δдredis
+	std::atomic<int64_t> _delta;
+	//_timerֻStartиֵ߳ͨ_b_startedжǷԽʱϲ
+	std::unique_ptr<boost::asio::steady_timer> _timer;
+	std::atomic<bool> _b_started;
+	std::atomic<bool> _b_stopped;
+	int _flush_ms;
+};
@@ -0,0 +1,195 @@
+#include "RedisBus.h"
+#include "ConfigMgr.h"
+#include "ChatServiceImpl.h"
+
+namespace {
+	//֡ʽ2ֽ + Ϣ峤4ֽ + Ϣ壬Ϊֽ
+	const std::size_t BUS_HEAD_LEN = 6;
+	//ӺPUBLISH̶redisʵϣֻʵڲת
+	const std::size_t BUS_REDIS_SHARD = 0;
+
+	void PutUint(std::string& out, uint64_t value, int bytes) {
+		for (int i = bytes - 1; i >= 0; --i) {
+			out.push_back((char)((value >> (i * 8)) & 0xFF));
+		}
+	}
+
+	uint64_t GetUint(const char* data, int bytes) {
+		uint64_t value = 0;
+		for (int i = 0; i < bytes; ++i) {
+			value = (value << 8) | (uint8_t)data[i];
+		}
+		return value;
+	}
+}
+
+RedisBus::RedisBus() :_b_enabled(false), _b_flush_posted(false)
+{
+	auto& cfg = ConfigMgr::Inst();
+	_b_enabled = cfg["PeerServer"]["Transport"] == "redis";
+	_self_channel = BUS_CHANNEL_PREFIX + cfg["SelfServer"]["Name"];
+}
+
+RedisBus::~RedisBus()
+{
+	Stop();
+	std::cout << "RedisBus destruct" << std::endl;
+}
+
+bool RedisBus::IsEnabled()
+{
+	return _b_enabled;
+}
+
+void RedisBus::Start()
+{
+	if (!_b_enabled || _thread.joinable()) {
+		return;
+	}
+	_service = std::make_unique<ChatServiceImpl>();
+	_work = std::make_unique<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(
+		boost::asio::make_work_guard(_io_context));
+
+	//ĺPUBLISHʽʹͬһʵkey·
+	auto& cfg = ConfigMgr::Inst();
+	auto addr = RedisMgr::LoadAddrs()[BUS_REDIS_SHARD];
+	_sub_conn = std::make_shared<AsyncRedisConn>(_io_context, addr.host, std::to_string(addr.port), cfg["Redis"]["pwd"]);
+	std::string subscribe;
+	AsyncRedis::EncodeCommand({ "SUBSCRIBE", _self_channel }, subscribe);
+	_sub_conn->AddInitCommand(std::move(subscribe));
+	_sub_conn->SetPushHandler([this](const RedisResult& result) {
+		HandleMessage(result);
+		});
+	_sub_conn->Start();
+
+	_thread = std::thread([this]() {
+		_io_context.run();
+		});
+	std::cout << "redis bus subscribe " << _self_channel << std::endl;
+}
+
+void RedisBus::Stop()
+{
+	if (!_thread.joinable()) {
+		return;
+	}
+	_sub_conn->Stop();
+	_io_context.stop();
+	_work.reset();
+	_thread.join();
+}
+
+void RedisBus::Publish(const std::string& server_name, BusMsgType type, const google::protobuf::Message& msg)
+{
+	auto body = msg.SerializeAsString();
+	bool need_post = false;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto& batch = _batches[server_name];
+		PutUint(batch.frames, type, 2);
+		PutUint(batch.frames, body.size(), 4);
+		batch.frames.append(body);
+		batch.starts.push_back(std::chrono::steady_clock::now());
+		if (!_b_flush_posted) {
+			_b_flush_posted = true;
+			need_post = true;
+		}
+	}
+
+	//ֻɿձΪǿʱͶһΣڼ۵֪ͨһ𷢳
+	if (need_post) {
+		boost::asio::post(_io_context, [this]() {
+			Flush();
+			});
+	}
+}
+
+LatencyHistogram& RedisBus::GetLatency()
+{
+	return _latency;
+}
+
+void RedisBus::Flush()
+{
+	std::unordered_map<std::string, Batch> batches;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		batches.swap(_batches);
+		_b_flush_posted = false;
+	}
+
+	for (auto& batch : batches) {
+		auto server_name = batch.first;
+		AsyncRedis::GetInstance()->CommandOnShard(BUS_REDIS_SHARD,
+			{ "PUBLISH", BUS_CHANNEL_PREFIX + batch.first, std::move(batch.second.frames) },
+			[this, server_name, starts = std::move(batch.second.starts)](const RedisResult& result) {
+				//grpcһڷͶõʱӼʱӽͨյȷϣʱһ
+				auto now = std::chrono::steady_clock::now();
+				for (auto& start : starts) {
+					_latency.Record(std::chrono::duration_cast<std::chrono::microseconds>(now - start).count());
+				}
+				if (result.IsError()) {
+					std::cout << "redis bus publish to " << server_name << " failed: " << result.str << std::endl;
+				}
+				else if (result.integer == 0) {
+					//ԷûжģûʱҲ
+					std::cout << "redis bus no subscriber for " << server_name << std::endl;
+				}
+			});
+	}
+}
+
+void RedisBus::HandleMessage(const RedisResult& result)
+{
+	//͸ʽΪ ["message", Ƶ, ]
+	if (result.elements.size() != 3) {
+		return;
+	}
+	auto& payload = result.elements[2].str;
+	std::size_t pos = 0;
+	while (pos + BUS_HEAD_LEN <= payload.size()) {
+		const char* head = payload.data() + pos;
+		int type = (int)GetUint(head, 2);
+		std::size_t len = (std::size_t)GetUint(head + 2, 4);
+		if (pos + BUS_HEAD_LEN + len > payload.size()) {
+			std::cout << "redis bus invalid frame" << std::endl;
+			return;
+		}
+		Dispatch(type, payload.data() + pos + BUS_HEAD_LEN, len);
+		pos += BUS_HEAD_LEN + len;
+	}
+}
+
+void RedisBus::Dispatch(int type, const char* data, std::size_t len)
+{
+	//grpcĴ߼ִ֤䷽ʽΪһ
+	switch (type) {
+	case BUS_ADD_FRIEND: {
+		AddFriendReq req;
+		AddFriendRsp rsp;
+		if (req.ParseFromArray(data, (int)len)) {
+			_service->NotifyAddFriend(nullptr, &req, &rsp);
+		}
+		break;
+	}
+	case BUS_AUTH_FRIEND: {
+		AuthFriendReq req;
+		AuthFriendRsp rsp;
+		if (req.ParseFromArray(data, (int)len)) {
+			_service->NotifyAuthFriend(nullptr, &req, &rsp);
+		}
+		break;
+	}
+	case BUS_TEXT_CHAT: {
+		TextChatMsgReq req;
+		TextChatMsgRsp rsp;
+		if (req.ParseFromArray(data, (int)len)) {
+			_service->NotifyTextChatMsg(nullptr, &req, &rsp);
+		}
+		break;
+	}
+	default:
+		std::cout << "redis bus unknown msg type " << type << std::endl;
+		break;
+	}
+}
@@ -3,98 +3,150 @@
 #include <atomic>
 #include <hiredis.h>
 #include <queue>
+#include <thread>
+#include <condition_variable>
+#include <vector>
+#include <string_view>
+#include <initializer_list>
+#include <map>
+
+//redisظָ룬ʱԶͷ
+struct RedisReplyDeleter {
+    void operator()(redisReply* reply) const {
+        freeReplyObject(reply);
+    }
+};
+typedef std::unique_ptr<redisReply, RedisReplyDeleter> RedisReplyPtr;
+//һĲбһԪΪ
+typedef std::vector<std::string> RedisCmd;
+
+//ӳصȴʱֱͼķͰ(΢)һͰͳƳ޵ĵȴ
+const int REDIS_WAIT_BUCKET_NUM = 5;
+const int64_t REDIS_WAIT_BUCKET_US[REDIS_WAIT_BUCKET_NUM - 1] = { 100, 1000, 10000, 100000 };
+//Ӻ͵ĳʱʱ
+const int REDIS_CONNECT_TIMEOUT_MS = 1000;
+const int REDIS_COMMAND_TIMEOUT_MS = 3000;
+//˱ʱ
+const int REDIS_RECONNECT_MAX_SEC = 30;
 
 class RedisConPool {
 public:
-    RedisConPool(size_t poolSize, const char* host, int port, const char* pwd)
-        : poolSize_(poolSize), host_(host), port_(port), b_stop_(false) {
-        for (size_t i = 0; i < poolSize_; ++i) {
-            auto* context = redisConnect(host, port);
-            if (context == nullptr || context->err != 0) {
-                if (context != nullptr) {
-                    redisFree(context);
-                }
-                continue;
-            }
-            std::cout << "ڳ֤Ϊ: " << pwd << std::endl;
-            auto reply = (redisReply*)redisCommand(context, "AUTH %s", pwd);
-            if (reply->type == REDIS_REPLY_ERROR) {
-                std::cout << "֤ʧ" << reply->str<< std::endl;
-                //ִгɹ ͷredisCommandִк󷵻صredisReplyռõڴ
-                freeReplyObject(reply);
-                continue;
-            }
-            //ִгɹ ͷredisCommandִк󷵻صredisReplyռõڴ
-            freeReplyObject(reply);
-            std::cout << "֤ɹ" << std::endl;
-            connections_.push(context);
-        }
-    }
-    ~RedisConPool() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        while (!connections_.empty()) {
-            connections_.pop();
-        }
-    }
-    redisContext* getConnection() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        cond_.wait(lock, [this] {
-            if (b_stop_) {
-                return true;
-            }
-            return !connections_.empty();
-            });
-        //ֱֹͣӷؿָ
-        if (b_stop_) {
-            return  nullptr;
-        }
-        auto* context = connections_.front();
-        connections_.pop();
-        return context;
-    }
-    void returnConnection(redisContext* context) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (b_stop_) {
-            return;
-        }
-        connections_.push(context);
-        cond_.notify_one();
-    }
-    void Close() {
-        b_stop_ = true;
-        cond_.notify_all();
-    }
+    RedisConPool(size_t poolSize, const std::string& host, int port, const std::string& pwd,
+        int acquireTimeoutMs, int checkIntervalSec);
+    ~RedisConPool();
+    //ȴacquireTimeoutMsӳѹرʱؿָ
+    redisContext* getConnection();
+    //ֱͷţɼ̲߳
+    void returnConnection(redisContext* context);
+    //״̬ȷʱãвδ͵ֱͷţɼ̲߳
+    void discardConnection(redisContext* context);
+    void Close();
+    int64_t GetWaitCount(int bucket);
+    int64_t GetTimeoutCount();
+    int64_t GetIdleCount();
 private:
+    redisContext* createConnection();
+    void checkThread();
+    //ԿִPINGϿͷŵ
+    void checkConnectionPro();
+    //ȱٵӣȫɹtrue
+    bool reconnect();
     std::atomic<bool> b_stop_;
     size_t poolSize_;
-    const char* host_;
+    std::string host_;
     int port_;
+    std::string pwd_;
+    int acquireTimeoutMs_;
+    int checkIntervalSec_;
     std::queue<redisContext*> connections_;
     std::mutex mutex_;
     std::condition_variable cond_;
+    //߳ãرʱ
+    std::mutex check_mutex_;
+    std::condition_variable check_cond_;
+    std::thread check_thread_;
+    //Ҫ
+    std::atomic<int> fail_count_;
+    std::atomic<int64_t> wait_hist_[REDIS_WAIT_BUCKET_NUM];
+    std::atomic<int64_t> timeout_count_;
 };
             
+struct RedisAddr {
+    std::string host;
+    int port;
+};
+
+//һԹϣÿredisʵڻϷREDIS_RING_REPLICASڵ
+//keyе{tag}ֻtag·ɣ_ֽβkeyuid·ɣͬһûkeyͬһʵ
+//ȫkey(֤롢¼)̶ڵһʵVarifyServerֻʵ
+const int REDIS_RING_REPLICAS = 160;
+class RedisRing {
+public:
+    void AddNode(size_t node, const std::string& name);
+    size_t GetNode(std::string_view key) const;
+    size_t Size() const { return node_num_; }
+    //ȡ·ɵĲ֣ؿձʾȫkey
+    static std::string_view RouteKey(std::string_view key);
+    static uint32_t Hash(std::string_view data);
+private:
+    std::map<uint32_t, size_t> ring_;
+    size_t node_num_ = 0;
+};
+
 class RedisMgr : public Singleton<RedisMgr>,
     public std::enable_shared_from_this<RedisMgr>
 {
     friend class Singleton<RedisMgr>;
 public:
     ~RedisMgr();
-    bool Get(const std::string& key, std::string& value);
-    bool Set(const std::string& key, const std::string& value);
-    bool Auth(const std::string& password);
-    bool LPush(const std::string& key, const std::string& value);
-    bool LPop(const std::string& key, std::string& value);
-    bool RPush(const std::string& key, const std::string& value);
-    bool RPop(const std::string& key, std::string& value);
-    bool HSet(const std::string& key, const std::string& hkey, const std::string& value);
+    //ȷͣkeyvalue԰ոͶ
+    bool Get(std::string_view key, std::string& value);
+    //replyлظڴ棬ReplyToViewȡֵٿһ
+    bool Get(std::string_view key, RedisReplyPtr& reply);
+    bool Set(std::string_view key, std::string_view value);
+    bool Auth(std::string_view password);
+    bool LPush(std::string_view key, std::string_view value);
+    bool LPop(std::string_view key, std::string& value);
+    bool RPush(std::string_view key, std::string_view value);
+    bool RPop(std::string_view key, std::string& value);
+    bool HSet(std::string_view key, std::string_view hkey, std::string_view value);
     bool HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen);
-    std::string HGet(const std::string& key, const std::string& hkey);
-    bool Del(const std::string& key);
-    bool ExistsKey(const std::string& key);
+    std::string HGet(std::string_view key, std::string_view hkey);
+    //ԭӵظϣֶμdeltaresultؼֵ
+    bool HIncrBy(std::string_view key, std::string_view hkey, long long delta, long long* result = nullptr);
+    bool Del(std::string_view key);
+    bool ExistsKey(std::string_view key);
+    //ȡkeyһڵkeyӦexistsΪfalse
+    bool MGet(const std::vector<std::string>& keys, std::vector<std::string>& values, std::vector<bool>& exists);
+    //ˮִжһrepliescmdsһһӦһشʱfalse
+    bool Pipeline(const std::vector<RedisCmd>& cmds, std::vector<RedisReplyPtr>& replies);
+    //MULTI/EXECԭִУrepliesΪEXECصĸ
+    bool Transaction(const std::vector<RedisCmd>& cmds, std::vector<RedisReplyPtr>& replies);
+    //ӳͳƣbucketӦREDIS_WAIT_BUCKET_USķͰ
+    int64_t GetPoolWaitCount(int bucket);
+    int64_t GetPoolTimeoutCount();
+    int64_t GetPoolIdleCount();
+    //ִһظʧܻkeykeyʵʱؿָ
+    RedisReplyPtr Command(std::initializer_list<std::string_view> args);
+    //ȡַ͵Ļظnilͷfalse
+    static bool ReplyToString(const redisReply* reply, std::string& value);
+    //ûظеַֻreplyͷǰЧ
+    static bool ReplyToView(const redisReply* reply, std::string_view& view);
+    //ȡ[Redis] HostsʽΪhost:port,host:portûʱʹHostPort
+    static std::vector<RedisAddr> LoadAddrs();
+    //keyڵʵ
+    size_t GetShard(std::string_view key);
     void Close();
 private:
     RedisMgr();
+    //keyڵʵkeykeyʵʱfalse
+    bool GetShard(const RedisCmd& cmd, size_t& shard);
+    //һʵˮִУظ׷ӵreplies
+    bool PipelineOn(size_t shard, const std::vector<const RedisCmd*>& cmds, std::vector<RedisReplyPtr>& replies);
+    bool AppendCommand(redisContext* connect, const RedisCmd& cmd);
+    bool GetReplies(redisContext* connect, size_t count, std::vector<RedisReplyPtr>& replies);
    
-    std::unique_ptr<RedisConPool> _con_pool ;
+    //ÿredisʵһӳأ±LoadAddrs˳һ
+    std::vector<std::unique_ptr<RedisConPool>> _con_pools;
+    RedisRing _ring;
 };
\ No newline at end of file
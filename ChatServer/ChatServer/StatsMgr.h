@@ -0,0 +1,42 @@
+#pragma once
+#include "const.h"
+#include "singleton.h"
+#include <mutex>
+#include <map>
+#include <functional>
+
+//ӳٷֲķͰ(΢)һͰͳƳ޵Ĳ
+const int LATENCY_BUCKET_NUM = 6;
+const int64_t LATENCY_BUCKET_US[LATENCY_BUCKET_NUM - 1] = { 500, 1000, 5000, 20000, 100000 };
+
+//Ͱӳֱͼ̶߳Լ¼
+class LatencyHistogram
+{
+public:
+	LatencyHistogram();
+	void Record(int64_t latency_us);
+	int64_t GetCount(int bucket);
+	//ѸͰעΪ<prefix>_<>ͳnotify_bus_1ms
+	void Register(const std::string& prefix);
+private:
+	std::atomic<int64_t> _counts[LATENCY_BUCKET_NUM];
+};
+
+//ʱͳĻϱʱѸģעļдredischatstats_<>ϣ
+class StatsMgr :public Singleton<StatsMgr>
+{
+	friend class Singleton<StatsMgr>;
+public:
+	~StatsMgr();
+	//עһͳϱʱcollectorȡǰֵ
+	void RegCollector(const std::string& name, std::function<int64_t()> collector);
+	void Start(boost::asio::io_context& io_context);
+	void Report();
+private:
+	StatsMgr();
+	void StartTimer();
+	std::mutex _mutex;
+	std::map<std::string, std::function<int64_t()>> _collectors;
+	std::unique_ptr<boost::asio::steady_timer> _timer;
+	int _interval;
+};
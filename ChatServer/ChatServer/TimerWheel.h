@@ -0,0 +1,32 @@
+#pragma once
+#include "const.h"
+#include <vector>
+#include <memory>
+
+class CSession;
+//ʱ֣ÿio߳һлỰ
+//ỰյʱֻԾʱ䣬ʱ֣ʱٰԾʱ²룬
+//ÿtickֻһۣʱĻỰر
+class TimerWheel
+{
+public:
+	TimerWheel(boost::asio::io_context& io_context, int timeout_sec);
+	~TimerWheel();
+	void Start();
+	//ʱio߳е
+	void AddSession(std::shared_ptr<CSession> session);
+private:
+	void StartTimer();
+	void Tick();
+	//ỰԾʱӦĲۣѾʱfalse
+	bool Insert(std::weak_ptr<CSession> session, time_t now);
+	void Cascade();
+	boost::asio::io_context& _io_context;
+	boost::asio::steady_timer _timer;
+	int _timeout_sec;
+	//Ѿ߹tickһtickΪһ
+	uint64_t _tick;
+	//һÿһ룬ڶÿTIMER_WHEEL_SLOTS
+	std::vector<std::weak_ptr<CSession>> _near[TIMER_WHEEL_SLOTS];
+	std::vector<std::weak_ptr<CSession>> _far[TIMER_WHEEL_SLOTS];
+};
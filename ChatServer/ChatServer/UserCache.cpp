@@ -0,0 +1,383 @@
+#include "UserCache.h"
+#include "ConfigMgr.h"
+#include "RedisMgr.h"
+#include "MysqlMgr.h"
+#include "JsonWriter.h"
+#include "AsioIOServicePool.h"
+
+UserCache::UserCache() :_shard_capacity(0), _ttl(USER_CACHE_TTL), _neg_ttl(USER_CACHE_NEGATIVE_TTL),
+	_hit(0), _miss(0), _neg_hit(0), _coalesced(0), _db_load(0)
+{
+	auto& cfg = ConfigMgr::Inst();
+	auto capacity_str = cfg["UserCache"]["Capacity"];
+	auto ttl_str = cfg["UserCache"]["TTL"];
+	auto neg_ttl_str = cfg["UserCache"]["NegativeTTL"];
+	std::size_t capacity = capacity_str.empty() ? USER_CACHE_CAPACITY : std::stoul(capacity_str);
+	if (!ttl_str.empty()) {
+		_ttl = std::chrono::seconds(std::stoi(ttl_str));
+	}
+	if (!neg_ttl_str.empty()) {
+		_neg_ttl = std::chrono::seconds(std::stoi(neg_ttl_str));
+	}
+	for (int i = 0; i < USER_CACHE_SHARD_NUM; ++i) {
+		_shards.emplace_back(new Shard());
+	}
+	//Ϊ0ʱرձػ
+	_shard_capacity = (capacity + USER_CACHE_SHARD_NUM - 1) / USER_CACHE_SHARD_NUM;
+}
+
+UserCache::~UserCache()
+{
+	std::cout << "UserCache destruct" << std::endl;
+}
+
+UserCache::Shard& UserCache::GetShard(int uid)
+{
+	return *_shards[(uint32_t)uid % USER_CACHE_SHARD_NUM];
+}
+
+uint64_t& UserCache::GetVersionSlot(Shard& shard, int uid)
+{
+	return shard._versions[(uint32_t)uid / USER_CACHE_SHARD_NUM % USER_CACHE_VERSION_SLOTS];
+}
+
+uint64_t UserCache::GetVersion(int uid)
+{
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	return GetVersionSlot(shard, uid);
+}
+
+bool UserCache::GetBaseInfo(int uid, std::shared_ptr<UserInfo>& userinfo)
+{
+	if (Get(uid, userinfo)) {
+		//Ŀ˵û
+		return userinfo != nullptr;
+	}
+
+	//ûٲredisֱڻظڴϽjson
+	auto version = GetVersion(uid);
+	std::string base_key = USER_BASE_INFO + std::to_string(uid);
+	RedisReplyPtr reply;
+	std::string_view info_str;
+	bool b_base = RedisMgr::GetInstance()->Get(base_key, reply);
+	if (b_base && RedisMgr::ReplyToView(reply.get(), info_str)) {
+		ParseBaseInfo(uid, info_str, userinfo, version);
+		return true;
+	}
+	//redisûѯmysql
+	return LoadBaseInfo(uid, userinfo);
+}
+
+bool UserCache::Get(int uid, std::shared_ptr<UserInfo>& userinfo)
+{
+	if (_shard_capacity == 0) {
+		return false;
+	}
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._index.find(uid);
+	if (iter == shard._index.end()) {
+		_miss.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	auto entry = iter->second;
+	if (entry->expire <= std::chrono::steady_clock::now()) {
+		shard._lru.erase(entry);
+		shard._index.erase(iter);
+		_miss.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	//Ƶͷ
+	shard._lru.splice(shard._lru.begin(), shard._lru, entry);
+	userinfo = entry->info;
+	if (userinfo == nullptr) {
+		_neg_hit.fetch_add(1, std::memory_order_relaxed);
+	}
+	else {
+		_hit.fetch_add(1, std::memory_order_relaxed);
+	}
+	return true;
+}
+
+void UserCache::Put(int uid, const std::shared_ptr<UserInfo>& userinfo, uint64_t version)
+{
+	Insert(uid, userinfo, _ttl, version);
+}
+
+void UserCache::Insert(int uid, const std::shared_ptr<UserInfo>& userinfo, std::chrono::seconds ttl, uint64_t version)
+{
+	if (_shard_capacity == 0) {
+		return;
+	}
+	auto expire = std::chrono::steady_clock::now() + ttl;
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	//ȡֱ֮ʧЧĿǾֵ
+	if (GetVersionSlot(shard, uid) != version) {
+		return;
+	}
+	auto iter = shard._index.find(uid);
+	if (iter != shard._index.end()) {
+		iter->second->info = userinfo;
+		iter->second->expire = expire;
+		shard._lru.splice(shard._lru.begin(), shard._lru, iter->second);
+		return;
+	}
+	shard._lru.push_front({ uid, userinfo, expire });
+	shard._index[uid] = shard._lru.begin();
+	//̭δʹõĿ
+	while (shard._lru.size() > _shard_capacity) {
+		shard._index.erase(shard._lru.back().uid);
+		shard._lru.pop_back();
+	}
+}
+
+void UserCache::Invalidate(int uid)
+{
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	//ʹûĿҲ汾ţڽеĶȡʱᱻ
+	++GetVersionSlot(shard, uid);
+	auto iter = shard._index.find(uid);
+	if (iter == shard._index.end()) {
+		return;
+	}
+	shard._lru.erase(iter->second);
+	shard._index.erase(iter);
+}
+
+bool UserCache::LoadBaseInfo(int uid, std::shared_ptr<UserInfo>& userinfo)
+{
+	std::promise<std::shared_ptr<UserInfo>> promise;
+	std::shared_future<std::shared_ptr<UserInfo>> future;
+	bool b_leader = false;
+	{
+		std::lock_guard<std::mutex> lock(_flight_mutex);
+		auto iter = _flights.find(uid);
+		if (iter != _flights.end()) {
+			future = iter->second;
+		}
+		else {
+			future = promise.get_future().share();
+			_flights.emplace(uid, future);
+			b_leader = true;
+		}
+	}
+
+	//߳ڲѯͬһuidȴĽ
+	if (!b_leader) {
+		_coalesced.fetch_add(1, std::memory_order_relaxed);
+		try {
+			userinfo = future.get();
+		}
+		catch (std::exception& e) {
+			std::cout << "wait user " << uid << " load failed, " << e.what() << std::endl;
+			return false;
+		}
+		return userinfo != nullptr;
+	}
+
+	//ѯƳ֮δ²ѯ
+	Defer defer([this, uid]() {
+		std::lock_guard<std::mutex> lock(_flight_mutex);
+		_flights.erase(uid);
+		});
+
+	//ѯݿ⣬汾ڲѯ֮ǰȡ
+	auto version = GetVersion(uid);
+	_db_load.fetch_add(1, std::memory_order_relaxed);
+	bool b_error = false;
+	std::shared_ptr<UserInfo> user_info = nullptr;
+	user_info = MysqlMgr::GetInstance()->GetUser(uid, b_error);
+	if (user_info == nullptr) {
+		//ȷϲڲŻĿѯʱ
+		if (!b_error) {
+			Insert(uid, nullptr, _neg_ttl, version);
+		}
+		promise.set_value(nullptr);
+		return false;
+	}
+
+	userinfo = user_info;
+	//Ȼѵȴ̣߳redisҪǵȴ
+	promise.set_value(user_info);
+
+	//ݿдredis
+	Json::Value redis_root;
+	redis_root["uid"] = uid;
+	redis_root["pwd"] = userinfo->pwd;
+	redis_root["name"] = userinfo->name;
+	redis_root["email"] = userinfo->email;
+	redis_root["nick"] = userinfo->nick;
+	redis_root["desc"] = userinfo->desc;
+	redis_root["sex"] = userinfo->sex;
+	redis_root["icon"] = userinfo->icon;
+	ExpectSelfSet(uid);
+	if (!RedisMgr::GetInstance()->Set(USER_BASE_INFO + std::to_string(uid), JsonWriter::Write(redis_root))) {
+		CancelSelfSet(uid);
+	}
+	Put(uid, userinfo, version);
+	return true;
+}
+
+void UserCache::ExpectSelfSet(int uid)
+{
+	if (_shard_capacity == 0) {
+		return;
+	}
+	auto now = std::chrono::steady_clock::now();
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	//ûпռ֪ͨʱǼǲᱻѣʱʱĵǼ
+	if (shard._self_sets.size() >= _shard_capacity) {
+		for (auto iter = shard._self_sets.begin(); iter != shard._self_sets.end();) {
+			if (iter->second.second <= now) {
+				iter = shard._self_sets.erase(iter);
+			}
+			else {
+				++iter;
+			}
+		}
+	}
+	auto& expect = shard._self_sets[uid];
+	expect.first++;
+	expect.second = now + _ttl;
+}
+
+void UserCache::CancelSelfSet(int uid)
+{
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._self_sets.find(uid);
+	if (iter == shard._self_sets.end()) {
+		return;
+	}
+	if (--iter->second.first <= 0) {
+		shard._self_sets.erase(iter);
+	}
+}
+
+bool UserCache::ConsumeSelfSet(int uid)
+{
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._self_sets.find(uid);
+	if (iter == shard._self_sets.end()) {
+		return false;
+	}
+	bool b_valid = iter->second.second > std::chrono::steady_clock::now();
+	if (--iter->second.first <= 0 || !b_valid) {
+		shard._self_sets.erase(iter);
+	}
+	return b_valid;
+}
+
+void UserCache::ParseBaseInfo(int uid, std::string_view info_str, std::shared_ptr<UserInfo>& userinfo, uint64_t version)
+{
+	Json::Reader reader;
+	Json::Value root;
+	reader.parse(info_str.data(), info_str.data() + info_str.size(), root);
+	//еĶᱻ¶
+	auto user_info = std::make_shared<UserInfo>();
+	user_info->uid = root["uid"].asInt();
+	user_info->name = root["name"].asString();
+	user_info->pwd = root["pwd"].asString();
+	user_info->email = root["email"].asString();
+	user_info->nick = root["nick"].asString();
+	user_info->desc = root["desc"].asString();
+	user_info->sex = root["sex"].asInt();
+	user_info->icon = root["icon"].asString();
+	userinfo = user_info;
+	Put(uid, userinfo, version);
+}
+
+void UserCache::Start()
+{
+	if (_shard_capacity == 0 || !_sub_conns.empty()) {
+		return;
+	}
+	//ÿredisʵҪģƬubaseinfo_ֲڸʵ
+	auto& cfg = ConfigMgr::Inst();
+	auto pwd = cfg["Redis"]["pwd"];
+	auto pool = AsioIOServicePool::GetInstance();
+	auto addrs = RedisMgr::LoadAddrs();
+	for (auto& addr : addrs) {
+		auto conn = std::make_shared<AsyncRedisConn>(pool->GetIOService(),
+			addr.host, std::to_string(addr.port), pwd);
+		std::string subscribe;
+		AsyncRedis::EncodeCommand({ "PSUBSCRIBE", "__keyspace@*__:" USER_BASE_INFO "*" }, subscribe);
+		conn->AddInitCommand(std::move(subscribe));
+		conn->SetPushHandler([this](const RedisResult& result) {
+			HandleNotify(result);
+			});
+		conn->Start();
+		_sub_conns.push_back(conn);
+	}
+}
+
+void UserCache::Stop()
+{
+	for (auto& conn : _sub_conns) {
+		conn->Stop();
+	}
+	_sub_conns.clear();
+}
+
+void UserCache::HandleNotify(const RedisResult& result)
+{
+	//͸ʽΪ ["pmessage", ģʽ, "__keyspace@0__:ubaseinfo_<uid>", ¼]
+	if (result.elements.size() != 4) {
+		return;
+	}
+	auto& channel = result.elements[2].str;
+	auto pos = channel.find(USER_BASE_INFO);
+	if (pos == std::string::npos) {
+		return;
+	}
+	auto uid_str = channel.substr(pos + strlen(USER_BASE_INFO));
+	if (uid_str.empty() || uid_str.find_first_not_of("0123456789") != std::string::npos) {
+		return;
+	}
+	int uid = std::stoi(uid_str);
+	//ִ֪ͨ˳򵽴ڵredisset֪̭ͨշĿ
+	if (result.elements[3].str == "set" && ConsumeSelfSet(uid)) {
+		return;
+	}
+	Invalidate(uid);
+}
+
+int64_t UserCache::GetHitCount()
+{
+	return _hit.load(std::memory_order_relaxed);
+}
+
+int64_t UserCache::GetMissCount()
+{
+	return _miss.load(std::memory_order_relaxed);
+}
+
+int64_t UserCache::GetNegativeHitCount()
+{
+	return _neg_hit.load(std::memory_order_relaxed);
+}
+
+int64_t UserCache::GetCoalescedCount()
+{
+	return _coalesced.load(std::memory_order_relaxed);
+}
+
+int64_t UserCache::GetDbLoadCount()
+{
+	return _db_load.load(std::memory_order_relaxed);
+}
+
+int64_t UserCache::GetSize()
+{
+	int64_t size = 0;
+	for (auto& shard : _shards) {
+		std::lock_guard<std::mutex> lock(shard->_mutex);
+		size += shard->_lru.size();
+	}
+	return size;
+}
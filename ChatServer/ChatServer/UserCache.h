@@ -0,0 +1,88 @@
+#pragma once
+#include "const.h"
+#include "singleton.h"
+#include "data.h"
+#include <list>
+#include <mutex>
+#include <future>
+#include <vector>
+#include <string_view>
+#include "AsyncRedis.h"
+
+//ڵûϢ棬˳Ϊػ桢redismysql
+//uidֶεLRUÿһĿTTLʧЧⶩredisļռ֪ͨ
+//ubaseinfo_<uid>κη޸Ļɾʱ̭Ŀ
+//ռ֪ͨҪredisnotify-keyspace-events K$gδʱTTL֤һ
+//ͬһuidδʱֻһ̲߳ѯmysql̵߳ȴ
+//ȷϲڵuidһĿNegativeTTLڲٲ
+//ÿʧЧuidİ汾ţredismysql֮ǰȡ汾ţʱ汾ѱ仯˵ĿǾֵٷ뻺
+class UserCache :public Singleton<UserCache>
+{
+	friend class Singleton<UserCache>;
+public:
+	~UserCache();
+	//صĶ󱻶߹ֻܶ޸
+	bool GetBaseInfo(int uid, std::shared_ptr<UserInfo>& userinfo);
+	//ֻ鱾ػ棬пĿʱtrueuserinfoΪnullptr
+	bool Get(int uid, std::shared_ptr<UserInfo>& userinfo);
+	//ڶȡredismysql֮ǰãĽ汾Ż
+	uint64_t GetVersion(int uid);
+	//version֮uidʧЧ
+	void Put(int uid, const std::shared_ptr<UserInfo>& userinfo, uint64_t version);
+	void Invalidate(int uid);
+	//mysqlزredisͱػ棬ͬһuidĲúϲΪһβѯ
+	bool LoadBaseInfo(int uid, std::shared_ptr<UserInfo>& userinfo);
+	//redisеjsonversionΪredis֮ǰȡõİ汾
+	void ParseBaseInfo(int uid, std::string_view info_str, std::shared_ptr<UserInfo>& userinfo, uint64_t version);
+	void Start();
+	void Stop();
+	int64_t GetHitCount();
+	int64_t GetMissCount();
+	int64_t GetSize();
+	int64_t GetNegativeHitCount();
+	int64_t GetCoalescedCount();
+	int64_t GetDbLoadCount();
+private:
+	UserCache();
+	struct CacheEntry {
+		int uid;
+		std::shared_ptr<UserInfo> info;
+		std::chrono::steady_clock::time_point expire;
+	};
+	struct alignas(64) Shard {
+		std::mutex _mutex;
+		//ͷΪʹõĿ
+		std::list<CacheEntry> _lru;
+		std::unordered_map<int, std::list<CacheEntry>::iterator> _index;
+		//ʧЧ汾ţuidȡλͬλuidʧЧֻһδ
+		uint64_t _versions[USER_CACHE_VERSION_SLOTS] = {};
+		//ڵredisûյsetֵ֪ͨΪͽֹʱ䣬ʱٵȴ
+		std::unordered_map<int, std::pair<int, std::chrono::steady_clock::time_point>> _self_sets;
+	};
+	Shard& GetShard(int uid);
+	uint64_t& GetVersionSlot(Shard& shard, int uid);
+	void Insert(int uid, const std::shared_ptr<UserInfo>& userinfo, std::chrono::seconds ttl, uint64_t version);
+	//redis֮ǰǼǣԼset֪̭ͨշĿ
+	void ExpectSelfSet(int uid);
+	void CancelSelfSet(int uid);
+	//ǱڵǼǹset֪ͨʱtrue
+	bool ConsumeSelfSet(int uid);
+	void HandleNotify(const RedisResult& result);
+	std::vector<std::unique_ptr<Shard>> _shards;
+	std::size_t _shard_capacity;
+	std::chrono::seconds _ttl;
+	//ڵuidĻʱ
+	std::chrono::seconds _neg_ttl;
+	std::atomic<int64_t> _hit;
+	std::atomic<int64_t> _miss;
+	std::atomic<int64_t> _neg_hit;
+	//ȴ̲߳ѯĴ
+	std::atomic<int64_t> _coalesced;
+	//ʵʲѯmysqlĴ
+	std::atomic<int64_t> _db_load;
+	//ڲѯmysqluid
+	std::mutex _flight_mutex;
+	std::unordered_map<int, std::shared_future<std::shared_ptr<UserInfo>>> _flights;
+	//ÿredisʵһ
+	std::vector<std::shared_ptr<AsyncRedisConn>> _sub_conns;
+};
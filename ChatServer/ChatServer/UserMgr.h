@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include "CSession.h"
+#include "ShardedMap.h"
 class UserMgr:public Singleton<UserMgr>
 {
 	friend class Singleton<UserMgr>;
@@ -11,10 +12,10 @@ public:
 	~UserMgr();
 	std::shared_ptr<CSession> GetSession(int uid);
 	void SetUserSession(int uid, shared_ptr<CSession> session);
-	void RmvUserSession(int uid, std::string session_id);
+	void RmvUserSession(int uid, uint64_t session_id);
 private:
 	UserMgr();
-	std::mutex _session_mtx;
-	std::unordered_map<int, std::shared_ptr<CSession>> _uid_to_session;
+	//uidỰgrpc̺߳߼̲߳ʱֻڶεĶ
+	ShardedMap<int, std::shared_ptr<CSession>> _uid_to_session;
 };
 
@@ -0,0 +1,131 @@
+//jsonл΢׼ϢͱȽд
+//  styled: ԭذʹõJson::Value::toStyledStringͻУÿηµַ
+//  stream: ÿ̻߳StreamWriterдostringstreamٿ
+//  direct: ڵJsonWriterֱд߸õַ
+//: g++ -O2 -std=c++17 -I../ChatServer -I/usr/include/jsoncpp JsonWriterBench.cpp ../ChatServer/JsonWriter.cpp -ljsoncpp -lboost_filesystem -o JsonWriterBench
+#include "JsonWriter.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <string>
+
+namespace {
+	Json::Value MakeUser(int uid) {
+		Json::Value user;
+		user["uid"] = uid;
+		user["name"] = "user_" + std::to_string(uid);
+		user["icon"] = ":/res/head_" + std::to_string(uid % 5 + 1) + ".jpg";
+		user["nick"] = "nick_" + std::to_string(uid);
+		user["sex"] = uid % 2;
+		user["desc"] = "hello, this is my profile";
+		user["back"] = "remark_" + std::to_string(uid);
+		return user;
+	}
+
+	Json::Value MakeHeartbeat() {
+		Json::Value root;
+		root["error"] = 0;
+		return root;
+	}
+
+	Json::Value MakeTextNotify() {
+		Json::Value root;
+		root["error"] = 0;
+		root["fromuid"] = 1001;
+		root["touid"] = 1002;
+		Json::Value text;
+		text["content"] = "see you at the meeting room at three o'clock";
+		text["msgid"] = "a3f1c2d4-5b6e-4f70-8a9b-0c1d2e3f4a5b";
+		root["text_array"].append(text);
+		return root;
+	}
+
+	Json::Value MakeSearchRsp() {
+		Json::Value root = MakeUser(1002);
+		root["error"] = 0;
+		root["pwd"] = "123456";
+		root["email"] = "user_1002@example.com";
+		return root;
+	}
+
+	//500ѵĵ¼ذ
+	Json::Value MakeLoginRsp() {
+		Json::Value root = MakeSearchRsp();
+		root["codec"] = "json";
+		for (int i = 0; i < 20; ++i) {
+			root["apply_list"].append(MakeUser(20000 + i));
+		}
+		for (int i = 0; i < 500; ++i) {
+			root["friend_list"].append(MakeUser(10000 + i));
+		}
+		return root;
+	}
+
+	//JsonWriterдÿ̻߳StreamWriterostringstreamеĽٿһ
+	void StreamWrite(const Json::Value& root, std::string& out) {
+		thread_local std::unique_ptr<Json::StreamWriter> writer([]() {
+			Json::StreamWriterBuilder builder;
+			builder["indentation"] = "";
+			builder["commentStyle"] = "None";
+			builder["emitUTF8"] = true;
+			return builder.newStreamWriter();
+			}());
+		thread_local std::ostringstream stream;
+		stream.str("");
+		stream.clear();
+		writer->write(root, &stream);
+		out = stream.str();
+	}
+
+	template <typename Func>
+	double Measure(int iterations, std::size_t& bytes, Func func) {
+		std::string out;
+		auto begin = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i) {
+			func(out);
+		}
+		auto cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+		bytes = out.size();
+		return cost / iterations;
+	}
+
+	void RunCase(const char* name, const Json::Value& root, int iterations) {
+		std::size_t styled_bytes = 0;
+		std::size_t stream_bytes = 0;
+		std::size_t direct_bytes = 0;
+		double styled_ns = Measure(iterations, styled_bytes, [&root](std::string& out) {
+			out = root.toStyledString();
+			});
+		double stream_ns = Measure(iterations, stream_bytes, [&root](std::string& out) {
+			StreamWrite(root, out);
+			});
+		double direct_ns = Measure(iterations, direct_bytes, [&root](std::string& out) {
+			JsonWriter::Write(root, out);
+			});
+		//ֽдһ
+		std::string stream_out;
+		std::string direct_out;
+		StreamWrite(root, stream_out);
+		JsonWriter::Write(root, direct_out);
+		if (stream_out != direct_out) {
+			std::cout << name << " output mismatch" << std::endl;
+		}
+		std::cout << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(0)
+			<< std::setw(10) << styled_bytes << std::setw(10) << direct_bytes
+			<< std::setw(12) << styled_ns << std::setw(12) << stream_ns << std::setw(12) << direct_ns
+			<< std::setprecision(2) << std::setw(9) << styled_ns / direct_ns << std::endl;
+	}
+}
+
+int main()
+{
+	std::cout << std::left << std::setw(14) << "msg" << std::right << std::setw(10) << "styled B"
+		<< std::setw(10) << "compact B" << std::setw(12) << "styled ns" << std::setw(12) << "stream ns"
+		<< std::setw(12) << "direct ns" << std::setw(9) << "speedup" << std::endl;
+	RunCase("heartbeat", MakeHeartbeat(), 200000);
+	RunCase("text_notify", MakeTextNotify(), 100000);
+	RunCase("search_rsp", MakeSearchRsp(), 100000);
+	RunCase("login_500", MakeLoginRsp(), 500);
+	return 0;
+}
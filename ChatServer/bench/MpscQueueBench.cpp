@@ -0,0 +1,150 @@
+//߼е΢׼ԭmutex+queueLogicWorkerʹõBlockingMpscQueueԱ
+//߳ģio߳Ͷݣһ߳ģLogicWorkerȡϢ
+//: g++ -O2 -std=c++17 -pthread -I../ChatServer MpscQueueBench.cpp -o MpscQueueBench
+#include "MpscQueue.h"
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <memory>
+#include <chrono>
+#include <atomic>
+#include <vector>
+
+namespace {
+	//LogicNodeһunique_ptrͶ
+	struct BenchNode {
+		explicit BenchNode(int64_t value) :_value(value) {}
+		int64_t _value;
+	};
+	using BenchNodePtr = std::unique_ptr<BenchNode>;
+
+	const std::size_t QUEUE_CAPACITY = 10000;
+	const std::size_t BATCH_SIZE = 64;
+
+	//֮ǰLogicWorkerĶУһstd::queueɿձǿʱ
+	class MutexQueue {
+	public:
+		MutexQueue() :_b_stop(false) {}
+		void Push(BenchNodePtr node) {
+			std::unique_lock<std::mutex> lock(_mutex);
+			_que.push(std::move(node));
+			if (_que.size() == 1) {
+				lock.unlock();
+				_consume.notify_one();
+			}
+		}
+		void Stop() {
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_b_stop = true;
+			}
+			_consume.notify_one();
+		}
+		//ȡԪ֮ͣУ
+		int64_t Consume() {
+			int64_t sum = 0;
+			for (;;) {
+				std::unique_lock<std::mutex> lock(_mutex);
+				while (_que.empty() && !_b_stop) {
+					_consume.wait(lock);
+				}
+				if (_que.empty()) {
+					break;
+				}
+				auto node = std::move(_que.front());
+				_que.pop();
+				lock.unlock();
+				sum += node->_value;
+			}
+			return sum;
+		}
+	private:
+		std::mutex _mutex;
+		std::condition_variable _consume;
+		std::queue<BenchNodePtr> _que;
+		bool _b_stop;
+	};
+
+	//LogicWorkerʹõBlockingMpscQueueѷʽLogicWorker::DealMsgͬ
+	class RingQueue {
+	public:
+		RingQueue() :_que(QUEUE_CAPACITY) {}
+		void Push(BenchNodePtr node) {
+			_que.Push(node);
+		}
+		void Stop() {
+			_que.Stop();
+		}
+		int64_t Consume() {
+			int64_t sum = 0;
+			std::vector<BenchNodePtr> batch;
+			batch.reserve(BATCH_SIZE);
+			for (;;) {
+				batch.clear();
+				if (_que.PopBatch(batch, BATCH_SIZE) == 0) {
+					break;
+				}
+				for (auto& node : batch) {
+					sum += node->_value;
+				}
+			}
+			return sum;
+		}
+	private:
+		BlockingMpscQueue<BenchNodePtr> _que;
+	};
+
+	//ÿ봦Ϣ()
+	template <typename Queue>
+	double RunBench(int producers, int64_t per_producer) {
+		Queue que;
+		int64_t sum = 0;
+		auto begin = std::chrono::steady_clock::now();
+		std::thread consumer([&que, &sum]() {
+			sum = que.Consume();
+			});
+		std::vector<std::thread> threads;
+		for (int i = 0; i < producers; ++i) {
+			threads.emplace_back([&que, per_producer]() {
+				for (int64_t n = 1; n <= per_producer; ++n) {
+					que.Push(BenchNodePtr(new BenchNode(n)));
+				}
+				});
+		}
+		for (auto& t : threads) {
+			t.join();
+		}
+		que.Stop();
+		consumer.join();
+		auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+		int64_t expect = producers * (per_producer * (per_producer + 1) / 2);
+		if (sum != expect) {
+			std::cout << "checksum mismatch, sum is " << sum << " expect " << expect << std::endl;
+		}
+		return producers * per_producer / cost / 1e6;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int64_t per_producer = argc > 1 ? std::atoll(argv[1]) : 1000000;
+	int rounds = 3;
+	std::cout << "messages per producer: " << per_producer << ", best of " << rounds << " rounds" << std::endl;
+	std::cout << std::setw(10) << "producers" << std::setw(16) << "mutex Mmsg/s"
+		<< std::setw(16) << "mpsc Mmsg/s" << std::setw(10) << "ratio" << std::endl;
+	for (int producers : { 1, 2, 4, 8 }) {
+		double mutex_best = 0;
+		double ring_best = 0;
+		for (int i = 0; i < rounds; ++i) {
+			mutex_best = (std::max)(mutex_best, RunBench<MutexQueue>(producers, per_producer));
+			ring_best = (std::max)(ring_best, RunBench<RingQueue>(producers, per_producer));
+		}
+		std::cout << std::setw(10) << producers << std::fixed << std::setprecision(2)
+			<< std::setw(16) << mutex_best << std::setw(16) << ring_best
+			<< std::setw(10) << ring_best / mutex_best << std::endl;
+	}
+	return 0;
+}
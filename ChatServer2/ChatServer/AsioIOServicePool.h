@@ -1,5 +1,6 @@
 #pragma once
 #include<vector>
+#include<atomic>
 #include<boost/asio.hpp>
 #include"singleton.h"
 class AsioIOServicePool:public Singleton<AsioIOServicePool>
@@ -14,12 +15,19 @@ public:
 	AsioIOServicePool& operator=(const AsioIOServicePool&) = delete;
 	//ʹround-robinķʽһio_service
 	boost::asio::io_context& GetIOService();
+	//round-robinһ±꣬Ҫ֪Ự߳ʱʹ
+	std::size_t NextIndex();
+	//±귵io_serviceÿ̸߳Լ
+	boost::asio::io_context& GetIOService(std::size_t index);
+	std::size_t Size();
 	void Stop();
 private:
-	AsioIOServicePool(std::size_t = 5);
+	//߳Ƿ˴õ[IOServicePool]ڶȡ߳Ϊ0ʱcpu
+	AsioIOServicePool();
+	void BindCpu(std::thread& thread, std::size_t cpu);
 	std::vector<IOService> _ioServices;
 	std::vector<WorkPtr> _works;
 	std::vector<std::thread> _threads;
-	std::size_t _nextIOService;
+	std::atomic<std::size_t> _nextIOService;
 };
 
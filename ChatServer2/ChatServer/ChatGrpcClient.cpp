@@ -1,6 +1,8 @@
 #include "ChatGrpcClient.h"
 #include "RedisMgr.h"
 #include "MysqlMgr.h"
+#include "JsonWriter.h"
+#include "UserCache.h"
 ChatGrpcClient::ChatGrpcClient()
 {
     auto& cfg = ConfigMgr::Inst();
@@ -33,8 +35,11 @@ AddFriendRsp ChatGrpcClient::NotifyAddFriend(std::string server_ip, const AddFri
 
 	auto& pool = find_iter->second;
 	ClientContext context;
+	auto start = std::chrono::steady_clock::now();
 	auto stub = pool->getConnection();
 	Status status = stub->NotifyAddFriend(&context, req, &rsp);
+	_latency.Record(std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start).count());
 	Defer defercon([&stub, this, &pool]() {
 		pool->returnConnection(std::move(stub));
 		});
@@ -62,8 +67,11 @@ AuthFriendRsp ChatGrpcClient::NotifyAuthFriend(std::string server_ip, const Auth
 
 	auto& pool = find_iter->second;
 	ClientContext context;
+	auto start = std::chrono::steady_clock::now();
 	auto stub = pool->getConnection();
 	Status status = stub->NotifyAuthFriend(&context, req, &rsp);
+	_latency.Record(std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start).count());
 	Defer defercon([&stub, this, &pool]() {
 		pool->returnConnection(std::move(stub));
 		});
@@ -76,47 +84,8 @@ AuthFriendRsp ChatGrpcClient::NotifyAuthFriend(std::string server_ip, const Auth
 	return rsp;
 }
 bool ChatGrpcClient::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo) {
-	//ȲredisвѯûϢ
-	std::string info_str = "";
-	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
-	if (b_base) {
-		Json::Reader reader;
-		Json::Value root;
-		reader.parse(info_str, root);
-		userinfo->uid = root["uid"].asInt();
-		userinfo->name = root["name"].asString();
-		userinfo->pwd = root["pwd"].asString();
-		userinfo->email = root["email"].asString();
-		userinfo->nick = root["nick"].asString();
-		userinfo->desc = root["desc"].asString();
-		userinfo->sex = root["sex"].asInt();
-		userinfo->icon = root["icon"].asString();
-		std::cout << "user login uid is  " << userinfo->uid << " name  is "
-			<< userinfo->name << " pwd is " << userinfo->pwd << " email is " << userinfo->email << std::endl;
-	}
-	else {
-		//redisûѯmysql
-		//ѯݿ
-		std::shared_ptr<UserInfo> user_info = nullptr;
-		user_info = MysqlMgr::GetInstance()->GetUser(uid);
-		if (user_info == nullptr) {
-			return false;
-		}
-
-		userinfo = user_info;
-
-		//ݿдredis
-		Json::Value redis_root;
-		redis_root["uid"] = uid;
-		redis_root["pwd"] = userinfo->pwd;
-		redis_root["name"] = userinfo->name;
-		redis_root["email"] = userinfo->email;
-		redis_root["nick"] = userinfo->nick;
-		redis_root["desc"] = userinfo->desc;
-		redis_root["sex"] = userinfo->sex;
-		redis_root["icon"] = userinfo->icon;
-		RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
-	}
+	//β鱾ػ桢redismysql
+	return UserCache::GetInstance()->GetBaseInfo(uid, userinfo);
 }
 TextChatMsgRsp ChatGrpcClient::NotifyTextChatMsg(std::string server_ip,
     const TextChatMsgReq& req, const Json::Value& rtvalue) {
@@ -137,8 +106,11 @@ TextChatMsgRsp ChatGrpcClient::NotifyTextChatMsg(std::string server_ip,
 	}
 	auto& pool = find_iter->second;
 	ClientContext context;
+	auto start = std::chrono::steady_clock::now();
 	auto stub = pool->getConnection();
 	Status status = stub->NotifyTextChatMsg(&context,req,&rsp);
+	_latency.Record(std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start).count());
 	Defer defercon([&stub,this,&pool]() {
 		pool->returnConnection(std::move(stub));
 		});
@@ -11,6 +11,7 @@
 #include <json/json.h>
 #include <json/value.h>
 #include <json/reader.h>
+#include "StatsMgr.h"
 
 using grpc::Channel;
 using grpc::Status;
@@ -93,8 +94,11 @@ public:
 	AuthFriendRsp NotifyAuthFriend(std::string server_ip, const AuthFriendReq& req);
 	bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo);
 	TextChatMsgRsp NotifyTextChatMsg(std::string server_ip, const TextChatMsgReq& req, const Json::Value& rtvalue);
+	//ӷ֪ͨ(ȡ)յԶ˻ظĺʱRedisBusһڷͶõʱͳ
+	LatencyHistogram& GetLatency() { return _latency; }
 private:
 	ChatGrpcClient();
 	std::unordered_map<std::string, std::unique_ptr<ChatConPool>> _pools;
+	LatencyHistogram _latency;
 };
 
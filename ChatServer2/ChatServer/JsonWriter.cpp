@@ -0,0 +1,69 @@
+#include "JsonWriter.h"
+#include <ostream>
+#include <streambuf>
+
+namespace {
+	//дֱַ׷ӵĿַ
+	class StringAppendBuf :public std::streambuf {
+	public:
+		StringAppendBuf() :_target(nullptr) {}
+		void SetTarget(std::string* target) {
+			_target = target;
+		}
+	protected:
+		int_type overflow(int_type ch) override {
+			if (_target == nullptr) {
+				return traits_type::eof();
+			}
+			if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+				_target->push_back(traits_type::to_char_type(ch));
+			}
+			return traits_type::not_eof(ch);
+		}
+		std::streamsize xsputn(const char* data, std::streamsize count) override {
+			if (_target == nullptr) {
+				return 0;
+			}
+			_target->append(data, (std::size_t)count);
+			return count;
+		}
+	private:
+		std::string* _target;
+	};
+
+	struct CompactWriter {
+		std::unique_ptr<Json::StreamWriter> writer;
+		StringAppendBuf buf;
+		std::ostream stream;
+		CompactWriter() :stream(&buf) {
+			Json::StreamWriterBuilder builder;
+			builder["indentation"] = "";
+			builder["commentStyle"] = "None";
+			//ĵȷasciiַԭת\uʽ
+			builder["emitUTF8"] = true;
+			writer.reset(builder.newStreamWriter());
+		}
+	};
+
+	CompactWriter& GetCompactWriter() {
+		thread_local CompactWriter compact_writer;
+		return compact_writer;
+	}
+}
+
+std::string JsonWriter::Write(const Json::Value& root)
+{
+	std::string out;
+	Write(root, out);
+	return out;
+}
+
+void JsonWriter::Write(const Json::Value& root, std::string& out)
+{
+	auto& compact_writer = GetCompactWriter();
+	out.clear();
+	compact_writer.buf.SetTarget(&out);
+	compact_writer.stream.clear();
+	compact_writer.writer->write(root, &compact_writer.stream);
+	compact_writer.buf.SetTarget(nullptr);
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "const.h"
+#include <string>
+
+//ոʽjsonлͻ
+//ÿ̻߳һStreamWriterظʹãÿιwriterֱдߵַм仺
+class JsonWriter
+{
+public:
+	static std::string Write(const Json::Value& root);
+	//outȱд룬ԭ߿Ԥռͬһַ
+	static void Write(const Json::Value& root, std::string& out);
+};
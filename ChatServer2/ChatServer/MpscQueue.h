@@ -0,0 +1,157 @@
+#pragma once
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+
+//нߵ߻ζ
+//ÿλһţCASռдλã߶ռλã
+template <typename T>
+class MpscQueue
+{
+public:
+	explicit MpscQueue(std::size_t capacity) :_enqueue_pos(0), _dequeue_pos(0) {
+		//ȡΪ2ݣȡģ
+		std::size_t size = 2;
+		while (size < capacity) {
+			size <<= 1;
+		}
+		_mask = size - 1;
+		_cells = std::vector<Cell>(size);
+		for (std::size_t i = 0; i < size; ++i) {
+			_cells[i]._sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	//߳̿ͬʱãɹʱdataУʱfalsedataֲ
+	bool Push(T& data) {
+		Cell* cell = nullptr;
+		std::size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+		for (;;) {
+			cell = &_cells[pos & _mask];
+			std::size_t seq = cell->_sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+			if (diff == 0) {
+				if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					break;
+				}
+			}
+			else if (diff < 0) {
+				return false;
+			}
+			else {
+				pos = _enqueue_pos.load(std::memory_order_relaxed);
+			}
+		}
+		cell->_data = std::move(data);
+		cell->_sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	//̵ֻ߳ãһȡmax_countԪأȡ
+	std::size_t PopBatch(std::vector<T>& out, std::size_t max_count) {
+		std::size_t count = 0;
+		while (count < max_count) {
+			Cell& cell = _cells[_dequeue_pos & _mask];
+			std::size_t seq = cell._sequence.load(std::memory_order_acquire);
+			if (seq != _dequeue_pos + 1) {
+				break;
+			}
+			out.push_back(std::move(cell._data));
+			cell._data = T();
+			cell._sequence.store(_dequeue_pos + _mask + 1, std::memory_order_release);
+			++_dequeue_pos;
+			++count;
+		}
+		return count;
+	}
+
+	//̵ֻ߳
+	bool Empty() const {
+		const Cell& cell = _cells[_dequeue_pos & _mask];
+		return cell._sequence.load(std::memory_order_acquire) != _dequeue_pos + 1;
+	}
+
+private:
+	struct Cell {
+		Cell() :_sequence(0) {}
+		Cell(Cell&& other) noexcept :_sequence(other._sequence.load(std::memory_order_relaxed)),
+			_data(std::move(other._data)) {}
+		Cell& operator=(Cell&& other) noexcept {
+			_sequence.store(other._sequence.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			_data = std::move(other._data);
+			return *this;
+		}
+		std::atomic<std::size_t> _sequence;
+		T _data;
+	};
+	//ߺߵλ÷ڲͬУα
+	alignas(64) std::atomic<std::size_t> _enqueue_pos;
+	alignas(64) std::size_t _dequeue_pos;
+	std::size_t _mask;
+	std::vector<Cell> _cells;
+};
+
+//MpscQueue֮ϼߵߺͻѣLogicWorkerϢ
+//ͶݲֻѾʱż
+template <typename T>
+class BlockingMpscQueue
+{
+public:
+	explicit BlockingMpscQueue(std::size_t capacity) :_que(capacity), _b_sleeping(false), _b_stop(false) {}
+	BlockingMpscQueue(const BlockingMpscQueue&) = delete;
+	BlockingMpscQueue& operator=(const BlockingMpscQueue&) = delete;
+
+	//߳̿ͬʱãʱóʱƬȴڳλã൱ڶѹ
+	void Push(T& data) {
+		while (!_que.Push(data)) {
+			std::this_thread::yield();
+		}
+		//߱ԣ֤ᶪʧ
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (_b_sleeping.load(std::memory_order_relaxed)) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			_consume.notify_one();
+		}
+	}
+
+	//̵ֻ߳ãһλѾȡΪʱߵȴ
+	//ֹͣԻȡʣԪأ0ʾѾֹͣҶΪ
+	std::size_t PopBatch(std::vector<T>& out, std::size_t max_count) {
+		for (;;) {
+			std::size_t count = _que.PopBatch(out, max_count);
+			if (count > 0) {
+				return count;
+			}
+			if (_b_stop) {
+				return 0;
+			}
+			std::unique_lock<std::mutex> lock(_mutex);
+			_b_sleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			_consume.wait(lock, [this]() {
+				return !_que.Empty() || _b_stop;
+				});
+			_b_sleeping.store(false, std::memory_order_relaxed);
+		}
+	}
+
+	//ߣȡʣԪغ˳
+	void Stop() {
+		_b_stop = true;
+		std::lock_guard<std::mutex> lock(_mutex);
+		_consume.notify_one();
+	}
+
+private:
+	MpscQueue<T> _que;
+	std::mutex _mutex;
+	std::condition_variable _consume;
+	std::atomic<bool> _b_sleeping;
+	std::atomic<bool> _b_stop;
+};
@@ -0,0 +1,321 @@
+#include "MsgCodec.h"
+#include "clientmsg.pb.h"
+#include "JsonWriter.h"
+#include <google/protobuf/descriptor.h>
+
+using google::protobuf::Message;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Reflection;
+using google::protobuf::RepeatedPtrField;
+
+namespace {
+	//ıֶι̶ֱӵɵķʺʡȥ䰴ֶ
+	void TextItemsToJson(const RepeatedPtrField<clientmsg::TextChatItem>& items, Json::Value& arrays)
+	{
+		arrays = Json::Value(Json::arrayValue);
+		for (auto& item : items) {
+			Json::Value element;
+			element["msgid"] = item.msgid();
+			element["content"] = item.content();
+			arrays.append(std::move(element));
+		}
+	}
+
+	void JsonToTextItems(const Json::Value& arrays, RepeatedPtrField<clientmsg::TextChatItem>* items)
+	{
+		if (!arrays.isArray()) {
+			return;
+		}
+		for (auto& element : arrays) {
+			auto item = items->Add();
+			item->set_msgid(element["msgid"].asString());
+			item->set_content(element["content"].asString());
+		}
+	}
+
+	bool DecodeTextChatReq(std::string_view data, Json::Value& root)
+	{
+		//ÿ̸߳һϢ󣬱ÿϢ·
+		thread_local clientmsg::TextChatReq msg;
+		if (!msg.ParseFromArray(data.data(), (int)data.size())) {
+			return false;
+		}
+		root["fromuid"] = msg.fromuid();
+		root["touid"] = msg.touid();
+		TextItemsToJson(msg.text_array(), root["text_array"]);
+		return true;
+	}
+
+	bool EncodeTextChatRsp(const Json::Value& root, std::string& data)
+	{
+		thread_local clientmsg::TextChatRsp msg;
+		msg.Clear();
+		msg.set_error(root["error"].asInt());
+		msg.set_fromuid(root["fromuid"].asInt());
+		msg.set_touid(root["touid"].asInt());
+		JsonToTextItems(root["text_array"], msg.mutable_text_array());
+		return msg.SerializeToString(&data);
+	}
+}
+
+MsgCodec::MsgCodec()
+{
+	RegMsg(MSG_CHAT_LOGIN, clientmsg::ChatLoginReq::default_instance());
+	RegMsg(MSG_CHAT_LOGIN_RSP, clientmsg::ChatLoginRsp::default_instance());
+	RegMsg(ID_SEARCH_USER_REQ, clientmsg::SearchUserReq::default_instance());
+	RegMsg(ID_SEARCH_USER_RSP, clientmsg::SearchUserRsp::default_instance());
+	RegMsg(ID_ADD_FRIEND_REQ, clientmsg::AddFriendApplyReq::default_instance());
+	RegMsg(ID_ADD_FRIEND_RSP, clientmsg::AddFriendApplyRsp::default_instance());
+	RegMsg(ID_NOTIFY_ADD_FRIEND_REQ, clientmsg::NotifyAddFriendReq::default_instance());
+	RegMsg(ID_AUTH_FRIEND_REQ, clientmsg::AuthFriendApplyReq::default_instance());
+	RegMsg(ID_AUTH_FRIEND_RSP, clientmsg::AuthFriendApplyRsp::default_instance());
+	RegMsg(ID_NOTIFY_AUTH_FRIEND_REQ, clientmsg::NotifyAuthFriendReq::default_instance());
+	RegMsg(ID_TEXT_CHAT_MSG_REQ, clientmsg::TextChatReq::default_instance());
+	RegMsg(ID_TEXT_CHAT_MSG_RSP, clientmsg::TextChatRsp::default_instance());
+	RegMsg(ID_NOTIFY_TEXT_CHAT_MSG_REQ, clientmsg::TextChatRsp::default_instance());
+	RegMsg(ID_HEARTBEAT_RSP, clientmsg::HeartBeatRsp::default_instance());
+
+	//¼շ̶jsonprotobufЭƵı
+	_decoders[ID_TEXT_CHAT_MSG_REQ] = DecodeTextChatReq;
+	_encoders[ID_TEXT_CHAT_MSG_RSP] = EncodeTextChatRsp;
+	_encoders[ID_NOTIFY_TEXT_CHAT_MSG_REQ] = EncodeTextChatRsp;
+}
+
+MsgCodec::~MsgCodec()
+{
+}
+
+void MsgCodec::RegMsg(short msg_id, const Message& prototype)
+{
+	_prototypes[msg_id] = &prototype;
+}
+
+int MsgCodec::ParseCodecName(const std::string& name)
+{
+	if (name == "protobuf") {
+		return CODEC_PROTOBUF;
+	}
+	return CODEC_JSON;
+}
+
+std::string MsgCodec::GetCodecName(int codec)
+{
+	if (codec == CODEC_PROTOBUF) {
+		return "protobuf";
+	}
+	return "json";
+}
+
+bool MsgCodec::Decode(int codec, short msg_id, std::string_view data, Json::Value& root)
+{
+	if (codec != CODEC_PROTOBUF) {
+		Json::Reader reader;
+		return reader.parse(data.data(), data.data() + data.size(), root);
+	}
+
+	auto fast_iter = _decoders.find(msg_id);
+	if (fast_iter != _decoders.end()) {
+		if (!fast_iter->second(data, root)) {
+			std::cout << "msg id [" << msg_id << "] parse protobuf failed" << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	auto iter = _prototypes.find(msg_id);
+	if (iter == _prototypes.end()) {
+		std::cout << "msg id [" << msg_id << "] has no protobuf type" << std::endl;
+		return false;
+	}
+	std::unique_ptr<Message> msg(iter->second->New());
+	if (!msg->ParseFromArray(data.data(), (int)data.size())) {
+		std::cout << "msg id [" << msg_id << "] parse protobuf failed" << std::endl;
+		return false;
+	}
+	ProtoToJson(*msg, root);
+	return true;
+}
+
+bool MsgCodec::Encode(int codec, short msg_id, const Json::Value& root, std::string& data)
+{
+	if (codec != CODEC_PROTOBUF) {
+		JsonWriter::Write(root, data);
+		return true;
+	}
+
+	auto fast_iter = _encoders.find(msg_id);
+	if (fast_iter != _encoders.end()) {
+		try {
+			return fast_iter->second(root, data);
+		}
+		catch (const std::exception& e) {
+			std::cout << "msg id [" << msg_id << "] convert to protobuf failed, " << e.what() << std::endl;
+			return false;
+		}
+	}
+
+	auto iter = _prototypes.find(msg_id);
+	if (iter == _prototypes.end()) {
+		std::cout << "msg id [" << msg_id << "] has no protobuf type" << std::endl;
+		return false;
+	}
+	std::unique_ptr<Message> msg(iter->second->New());
+	try {
+		JsonToProto(root, msg.get());
+	}
+	catch (const std::exception& e) {
+		//ֶϢ岻
+		std::cout << "msg id [" << msg_id << "] convert to protobuf failed, " << e.what() << std::endl;
+		return false;
+	}
+	return msg->SerializeToString(&data);
+}
+
+void MsgCodec::ProtoToJson(const Message& msg, Json::Value& root)
+{
+	//δõֶҲĬֵjsonЭ´ȡֵһ
+	auto descriptor = msg.GetDescriptor();
+	auto reflection = msg.GetReflection();
+	for (int i = 0; i < descriptor->field_count(); ++i) {
+		auto field = descriptor->field(i);
+		auto& value = root[field->name()];
+		if (field->is_repeated()) {
+			value = Json::Value(Json::arrayValue);
+			int size = reflection->FieldSize(msg, field);
+			for (int j = 0; j < size; ++j) {
+				switch (field->cpp_type()) {
+				case FieldDescriptor::CPPTYPE_INT32:
+					value.append(reflection->GetRepeatedInt32(msg, field, j));
+					break;
+				case FieldDescriptor::CPPTYPE_INT64:
+					value.append((Json::Int64)reflection->GetRepeatedInt64(msg, field, j));
+					break;
+				case FieldDescriptor::CPPTYPE_UINT32:
+					value.append(reflection->GetRepeatedUInt32(msg, field, j));
+					break;
+				case FieldDescriptor::CPPTYPE_UINT64:
+					value.append((Json::UInt64)reflection->GetRepeatedUInt64(msg, field, j));
+					break;
+				case FieldDescriptor::CPPTYPE_BOOL:
+					value.append(reflection->GetRepeatedBool(msg, field, j));
+					break;
+				case FieldDescriptor::CPPTYPE_STRING:
+					value.append(reflection->GetRepeatedString(msg, field, j));
+					break;
+				case FieldDescriptor::CPPTYPE_MESSAGE: {
+					Json::Value element;
+					ProtoToJson(reflection->GetRepeatedMessage(msg, field, j), element);
+					value.append(element);
+					break;
+				}
+				default:
+					break;
+				}
+			}
+			continue;
+		}
+
+		switch (field->cpp_type()) {
+		case FieldDescriptor::CPPTYPE_INT32:
+			value = reflection->GetInt32(msg, field);
+			break;
+		case FieldDescriptor::CPPTYPE_INT64:
+			value = (Json::Int64)reflection->GetInt64(msg, field);
+			break;
+		case FieldDescriptor::CPPTYPE_UINT32:
+			value = reflection->GetUInt32(msg, field);
+			break;
+		case FieldDescriptor::CPPTYPE_UINT64:
+			value = (Json::UInt64)reflection->GetUInt64(msg, field);
+			break;
+		case FieldDescriptor::CPPTYPE_BOOL:
+			value = reflection->GetBool(msg, field);
+			break;
+		case FieldDescriptor::CPPTYPE_STRING:
+			value = reflection->GetString(msg, field);
+			break;
+		case FieldDescriptor::CPPTYPE_MESSAGE:
+			ProtoToJson(reflection->GetMessage(msg, field), value);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+void MsgCodec::JsonToProto(const Json::Value& root, Message* msg)
+{
+	//ֻתϢеֶΣjsonжֶκ
+	auto descriptor = msg->GetDescriptor();
+	auto reflection = msg->GetReflection();
+	for (int i = 0; i < descriptor->field_count(); ++i) {
+		auto field = descriptor->field(i);
+		if (!root.isMember(field->name())) {
+			continue;
+		}
+		auto& value = root[field->name()];
+		if (value.isNull()) {
+			continue;
+		}
+
+		if (field->is_repeated()) {
+			if (!value.isArray()) {
+				continue;
+			}
+			for (auto& element : value) {
+				switch (field->cpp_type()) {
+				case FieldDescriptor::CPPTYPE_INT32:
+					reflection->AddInt32(msg, field, element.asInt());
+					break;
+				case FieldDescriptor::CPPTYPE_INT64:
+					reflection->AddInt64(msg, field, element.asInt64());
+					break;
+				case FieldDescriptor::CPPTYPE_UINT32:
+					reflection->AddUInt32(msg, field, element.asUInt());
+					break;
+				case FieldDescriptor::CPPTYPE_UINT64:
+					reflection->AddUInt64(msg, field, element.asUInt64());
+					break;
+				case FieldDescriptor::CPPTYPE_BOOL:
+					reflection->AddBool(msg, field, element.asBool());
+					break;
+				case FieldDescriptor::CPPTYPE_STRING:
+					reflection->AddString(msg, field, element.asString());
+					break;
+				case FieldDescriptor::CPPTYPE_MESSAGE:
+					JsonToProto(element, reflection->AddMessage(msg, field));
+					break;
+				default:
+					break;
+				}
+			}
+			continue;
+		}
+
+		switch (field->cpp_type()) {
+		case FieldDescriptor::CPPTYPE_INT32:
+			reflection->SetInt32(msg, field, value.asInt());
+			break;
+		case FieldDescriptor::CPPTYPE_INT64:
+			reflection->SetInt64(msg, field, value.asInt64());
+			break;
+		case FieldDescriptor::CPPTYPE_UINT32:
+			reflection->SetUInt32(msg, field, value.asUInt());
+			break;
+		case FieldDescriptor::CPPTYPE_UINT64:
+			reflection->SetUInt64(msg, field, value.asUInt64());
+			break;
+		case FieldDescriptor::CPPTYPE_BOOL:
+			reflection->SetBool(msg, field, value.asBool());
+			break;
+		case FieldDescriptor::CPPTYPE_STRING:
+			reflection->SetString(msg, field, value.asString());
+			break;
+		case FieldDescriptor::CPPTYPE_MESSAGE:
+			JsonToProto(value, reflection->MutableMessage(msg, field));
+			break;
+		default:
+			break;
+		}
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "const.h"
+#include "MsgNode.h"
+#include <string>
+#include <atomic>
+
+//ϢѹʹzlibdeflateԤһݰϢṹֵ䣬
+//ϢظֵֶҲܱѹÿ̸߳һѹͽѹظʼ
+class MsgCompress
+{
+public:
+	static bool Compress(const char* data, std::size_t len, std::string& out);
+	//ѹĳȳmax_lenΪǷ
+	static bool Decompress(const char* data, std::size_t len, std::string& out, std::size_t max_len);
+	//ֱӽѹڴĽջout_lenΪѹĳȣʡȥмַһο
+	static bool Decompress(const char* data, std::size_t len, boost::intrusive_ptr<RecvBuffer>& out,
+		std::size_t& out_len, std::size_t max_len);
+	//ѹǰۼƵֽͳʹ
+	static int64_t GetRawBytes();
+	static int64_t GetCompressedBytes();
+private:
+	static std::atomic<int64_t> _raw_bytes;
+	static std::atomic<int64_t> _compressed_bytes;
+};
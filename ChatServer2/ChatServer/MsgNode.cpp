@@ -1,17 +1,54 @@
 #include "MsgNode.h"
 
-RecvNode::RecvNode(short max_len, short msg_id) :MsgNode(max_len),
-_msg_id(msg_id)
+RecvNode::RecvNode(boost::intrusive_ptr<RecvBuffer> buffer, const char* data, std::size_t len, short msg_id)
+	:_data(data), _cur_len(len), _buffer(buffer), _msg_id(msg_id)
 {
 }
 
-SendNode::SendNode(const char* msg, short max_len, short msg_id) :MsgNode(max_len + HEAD_TOTAL_LEN)
-, _msg_id(msg_id) {
-	//ȷid, תΪֽ
-	short msg_id_host = boost::asio::detail::socket_ops::host_to_network_short(msg_id);
-	memcpy(_data, &msg_id_host, HEAD_ID_LEN);
-	//תΪֽ
-	short max_len_host = boost::asio::detail::socket_ops::host_to_network_short(max_len);
-	memcpy(_data + HEAD_ID_LEN, &max_len_host, HEAD_DATA_LEN);
-	memcpy(_data + HEAD_ID_LEN + HEAD_DATA_LEN, msg, max_len);
+SendNode::SendNode(const char* msg, std::size_t max_len, short msg_id, bool b_ext_head, unsigned short flags)
+	:MsgNode(max_len + (b_ext_head ? HEAD_EXT_TOTAL_LEN : HEAD_TOTAL_LEN))
+, _msg_id(msg_id), _flags(b_ext_head ? flags : 0), _head_len(b_ext_head ? HEAD_EXT_TOTAL_LEN : HEAD_TOTAL_LEN), _next(nullptr) {
+	if (!b_ext_head) {
+		//ȷid, תΪֽ
+		short msg_id_host = boost::asio::detail::socket_ops::host_to_network_short(msg_id);
+		memcpy(_data, &msg_id_host, HEAD_ID_LEN);
+		//תΪֽ
+		short max_len_host = boost::asio::detail::socket_ops::host_to_network_short((short)max_len);
+		memcpy(_data + HEAD_ID_LEN, &max_len_host, HEAD_DATA_LEN);
+		memcpy(_data + HEAD_ID_LEN + HEAD_DATA_LEN, msg, max_len);
+		return;
+	}
+
+	//չͷidλ1Ϊ4ֽڣƬʱһƬMORE־Ƭͷ
+	std::size_t frag_count = (std::max)((max_len + (MAX_FRAME_LEN) - 1) / (MAX_FRAME_LEN), (std::size_t)1);
+	_frag_heads.resize((frag_count - 1) * HEAD_EXT_TOTAL_LEN);
+	for (std::size_t i = 0; i < frag_count; ++i) {
+		std::size_t frag_len = (std::min)(max_len - i * (MAX_FRAME_LEN), (std::size_t)(MAX_FRAME_LEN));
+		unsigned short frag_flags = i + 1 < frag_count ? (flags | MSG_FLAG_MORE) : flags;
+		char* head = i == 0 ? _data : &_frag_heads[(i - 1) * HEAD_EXT_TOTAL_LEN];
+		unsigned short head_id = boost::asio::detail::socket_ops::host_to_network_short(
+			(unsigned short)(msg_id | HEAD_EXT_MASK));
+		memcpy(head, &head_id, HEAD_ID_LEN);
+		unsigned short flags_host = boost::asio::detail::socket_ops::host_to_network_short(frag_flags);
+		memcpy(head + HEAD_ID_LEN, &flags_host, HEAD_FLAG_LEN);
+		uint32_t frag_len_host = boost::asio::detail::socket_ops::host_to_network_long((uint32_t)frag_len);
+		memcpy(head + HEAD_ID_LEN + HEAD_FLAG_LEN, &frag_len_host, HEAD_EXT_DATA_LEN);
+	}
+	memcpy(_data + HEAD_EXT_TOTAL_LEN, msg, max_len);
+}
+
+void SendNode::GetBuffers(std::vector<boost::asio::const_buffer>& bufs) const
+{
+	if (_frag_heads.empty()) {
+		bufs.emplace_back(_data, _total_len);
+		return;
+	}
+	//һƬͷϢţ֮ÿƬȷͷٷӦϢ
+	const char* body = _data + _head_len;
+	std::size_t body_len = _total_len - _head_len;
+	bufs.emplace_back(_data, _head_len + (MAX_FRAME_LEN));
+	for (std::size_t offset = (MAX_FRAME_LEN); offset < body_len; offset += (MAX_FRAME_LEN)) {
+		bufs.emplace_back(_frag_heads.data() + (offset / (MAX_FRAME_LEN) - 1) * HEAD_EXT_TOTAL_LEN, HEAD_EXT_TOTAL_LEN);
+		bufs.emplace_back(body + offset, (std::min)(body_len - offset, (std::size_t)(MAX_FRAME_LEN)));
+	}
 }
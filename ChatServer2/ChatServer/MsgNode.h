@@ -3,20 +3,22 @@
 #include "const.h"
 #include <iostream>
 #include <boost/asio.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+#include "MsgPool.h"
 using namespace std;
 using boost::asio::ip::tcp;
 class LogicSystem;
 class MsgNode
 {
 public:
-	MsgNode(short max_len) :_total_len(max_len), _cur_len(0) {
-		_data = new char[_total_len + 1]();
+	MsgNode(std::size_t max_len) :_cur_len(0), _total_len(max_len) {
+		//ڴط䣬ᱻд룬Ҫ
+		_data = MsgPool::Allocate(_total_len + 1, _capacity);
 		_data[_total_len] = '\0';
 	}
 
 	~MsgNode() {
-		std::cout << "destruct MsgNode" << endl;
-		delete[] _data;
+		MsgPool::Deallocate(_data, _capacity);
 	}
 
 	void Clear() {
@@ -24,24 +26,70 @@ public:
 		_cur_len = 0;
 	}
 
-	short _cur_len;
-	short _total_len;
+	std::size_t _cur_len;
+	std::size_t _total_len;
 	char* _data;
+	std::size_t _capacity;
 };
 
-class RecvNode :public MsgNode {
+//ջһζȡĶϢͬһڴ棬ü
+//üǶڶУshared_ptrĿƿ
+class RecvBuffer :public PoolObject<RecvBuffer>
+{
+public:
+	RecvBuffer(std::size_t capacity) :_ref_count(0) {
+		_data = MsgPool::Allocate(capacity, _capacity);
+	}
+	~RecvBuffer() {
+		MsgPool::Deallocate(_data, _capacity);
+	}
+	RecvBuffer(const RecvBuffer&) = delete;
+	RecvBuffer& operator=(const RecvBuffer&) = delete;
+	int UseCount() const {
+		return _ref_count.load(std::memory_order_acquire);
+	}
+	friend void intrusive_ptr_add_ref(RecvBuffer* buffer) {
+		buffer->_ref_count.fetch_add(1, std::memory_order_relaxed);
+	}
+	friend void intrusive_ptr_release(RecvBuffer* buffer) {
+		if (buffer->_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			delete buffer;
+		}
+	}
+	char* _data;
+	std::size_t _capacity;
+private:
+	std::atomic<int> _ref_count;
+};
+
+//RecvNodeֻýջеһΣϢ
+class RecvNode :public PoolObject<RecvNode> {
 	friend class LogicSystem;
 public:
-	RecvNode(short max_len, short msg_id);
+	RecvNode(boost::intrusive_ptr<RecvBuffer> buffer, const char* data, std::size_t len, short msg_id);
+	const char* _data;
+	std::size_t _cur_len;
 private:
+	boost::intrusive_ptr<RecvBuffer> _buffer;
 	short _msg_id;
 };
 
-class SendNode :public MsgNode {
+class SendNode :public MsgNode, public PoolObject<SendNode> {
 	friend class LogicSystem;
+	friend class CSession;
 public:
-	SendNode(const char* msg, short max_len, short msg_id);
+	//b_ext_headΪtrueʱʹչͷΪ4ֽڣflagsֻչͷЯ
+	//չͷϢ峬MAX_FRAME_LENʱƬͣһڵ㣬ת涼Ϣ
+	SendNode(const char* msg, std::size_t max_len, short msg_id, bool b_ext_head, unsigned short flags = 0);
+	//Ѵ͵׷ӵbufsƬϢÿƬԼͷ
+	void GetBuffers(std::vector<boost::asio::const_buffer>& bufs) const;
 private:
 	short _msg_id;
+	unsigned short _flags;
+	std::size_t _head_len;
+	//ڶƬƬͷδţƬʱΪ
+	std::string _frag_heads;
+	//ʽָ룬ڻỰͶ
+	SendNode* _next;
 };
 
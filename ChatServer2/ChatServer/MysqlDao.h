@@ -17,6 +17,8 @@ public:
 	bool GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>& applyList, int begin, int limit);
 	bool ConfirmFriendApply(const int& from, const int& to, const std::string& back_name);
 	std::shared_ptr<UserInfo> GetUser(int uid);
+	//b_errorֲѯʧܺûڣ߶nullptr
+	std::shared_ptr<UserInfo> GetUser(int uid, bool& b_error);
 	std::shared_ptr<UserInfo> GetUser(std::string name);
 	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info);
 private:
@@ -0,0 +1,120 @@
+#include "OnlineCounter.h"
+#include "ConfigMgr.h"
+#include "RedisMgr.h"
+#include "AsyncRedis.h"
+
+OnlineCounter::OnlineCounter() :_online(0), _delta(0), _b_started(false), _b_stopped(false), _flush_ms(1000)
+{
+	auto& cfg = ConfigMgr::Inst();
+	_server_name = cfg["SelfServer"]["Name"];
+	auto flush_str = cfg["Stats"]["CounterFlushMs"];
+	if (!flush_str.empty()) {
+		_flush_ms = std::stoi(flush_str);
+	}
+}
+
+OnlineCounter::~OnlineCounter()
+{
+	std::cout << "OnlineCounter destruct" << std::endl;
+}
+
+void OnlineCounter::Incr()
+{
+	_online.fetch_add(1, std::memory_order_relaxed);
+	_delta.fetch_add(1);
+	FlushIfNotMerging();
+}
+
+void OnlineCounter::Decr()
+{
+	_online.fetch_sub(1, std::memory_order_relaxed);
+	_delta.fetch_sub(1);
+	FlushIfNotMerging();
+}
+
+int64_t OnlineCounter::GetOnline()
+{
+	return _online.load(std::memory_order_relaxed);
+}
+
+void OnlineCounter::Start(boost::asio::io_context& io_context)
+{
+	if (_flush_ms <= 0 || _b_stopped) {
+		return;
+	}
+	_timer = std::make_unique<boost::asio::steady_timer>(io_context);
+	StartTimer();
+	//ʱٴ򿪺ϲ֮ǰһ
+	_b_started = true;
+}
+
+void OnlineCounter::Stop()
+{
+	//ֹͣȡ֮ǰд룬֮FlushIfNotMergingͬд
+	if (_b_stopped.exchange(true)) {
+		return;
+	}
+	//ʱ̰߳ȫģͶݵio߳ȡio_contextֹͣʱصҲֹͣ
+	if (_b_started) {
+		boost::asio::post(_timer->get_executor(), [this]() {
+			_timer->cancel();
+			});
+	}
+	FlushSync();
+}
+
+void OnlineCounter::FlushIfNotMerging()
+{
+	if (_b_stopped) {
+		//ͣʱ첽Ӽرգֱͬд
+		FlushSync();
+	}
+	else if (!_b_started) {
+		Flush();
+	}
+}
+
+void OnlineCounter::StartTimer()
+{
+	_timer->expires_after(std::chrono::milliseconds(_flush_ms));
+	_timer->async_wait([this](const boost::system::error_code& ec) {
+		if (ec || _b_stopped) {
+			return;
+		}
+		Flush();
+		StartTimer();
+		});
+}
+
+void OnlineCounter::Flush()
+{
+	auto delta = _delta.exchange(0);
+	if (delta == 0) {
+		return;
+	}
+	AsyncRedis::GetInstance()->Command({ "HINCRBY", LOGIN_COUNT, _server_name, std::to_string(delta) },
+		[this, delta](const RedisResult& result) {
+			if (!result.IsError()) {
+				return;
+			}
+			std::cout << "flush online count failed: " << result.str << std::endl;
+			//ֻȷûȥŷŻԣѷûյظĿѾִУԻظ
+			if (result.b_not_sent) {
+				_delta.fetch_add(delta);
+				if (_b_stopped) {
+					FlushSync();
+				}
+			}
+		});
+}
+
+void OnlineCounter::FlushSync()
+{
+	auto delta = _delta.exchange(0);
+	if (delta == 0) {
+		return;
+	}
+	if (!RedisMgr::GetInstance()->HIncrBy(LOGIN_COUNT, _server_name, delta)) {
+		std::cout << "flush online count failed, lost delta " << delta << std::endl;
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "const.h"
+#include "singleton.h"
+#include "AsyncRedis.h"
+#include "StatsMgr.h"
+#include <thread>
+#include <google/protobuf/message.h>
+
+class ChatServiceImpl;
+
+//ϴݵ֪ͨͣϢΪӦgrpc
+enum BusMsgType {
+	BUS_ADD_FRIEND = 1,    //AddFriendReq
+	BUS_AUTH_FRIEND = 2,   //AuthFriendReq
+	BUS_TEXT_CHAT = 3,     //TextChatMsgReq
+};
+
+//redisĵĿ֪ͨͨ[PeerServer] Transport = redisʱԵgrpc
+//ÿ̨ChatServerchatbus_<Լ>Ƶڵ㲻Ҫ޸ڵPeerServer
+//ͬһ̨֪ͨ߳ȡǰϲһPUBLISH
+class RedisBus :public Singleton<RedisBus>
+{
+	friend class Singleton<RedisBus>;
+public:
+	~RedisBus();
+	bool IsEnabled();
+	void Start();
+	void Stop();
+	//̶߳Եãserver_nameΪĿChatServer
+	void Publish(const std::string& server_name, BusMsgType type, const google::protobuf::Message& msg);
+	//ӵPublishredisȷPUBLISHĺʱgrpc֪ͨͳƿھһ
+	LatencyHistogram& GetLatency();
+private:
+	RedisBus();
+	void Flush();
+	void HandleMessage(const RedisResult& result);
+	void Dispatch(int type, const char* data, std::size_t len);
+	bool _b_enabled;
+	std::string _self_channel;
+	//Ӻ֪ͨڶ̣߳вѯredisio߳
+	boost::asio::io_context _io_context;
+	std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> _work;
+	std::thread _thread;
+	std::shared_ptr<AsyncRedisConn> _sub_conn;
+	//ͬһ̨Ĵ֡startsΪÿ֪ͨеʱ
+	struct Batch {
+		std::string frames;
+		std::vector<std::chrono::steady_clock::time_point> starts;
+	};
+	std::mutex _mutex;
+	//Ŀֵ֡ӳ
+	std::unordered_map<std::string, Batch> _batches;
+	bool _b_flush_posted;
+	std::unique_ptr<ChatServiceImpl> _service;
+	LatencyHistogram _latency;
+};
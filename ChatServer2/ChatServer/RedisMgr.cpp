@@ -1,330 +1,836 @@
 #include "RedisMgr.h"
 #include "ConfigMgr.h"
+#include <algorithm>
+#include <cctype>
 
+namespace {
+    //keykeyλãredis COMMANDfirst/last/stepһ£lastΪʾĩβ
+    struct KeySpec {
+        const char* name;
+        int first;
+        int last;
+        int step;
+    };
+    const KeySpec MULTI_KEY_CMDS[] = {
+        { "MGET", 1, -1, 1 }, { "DEL", 1, -1, 1 }, { "UNLINK", 1, -1, 1 },
+        { "EXISTS", 1, -1, 1 }, { "TOUCH", 1, -1, 1 }, { "WATCH", 1, -1, 1 },
+        { "MSET", 1, -1, 2 }, { "MSETNX", 1, -1, 2 },
+        { "SUNION", 1, -1, 1 }, { "SINTER", 1, -1, 1 }, { "SDIFF", 1, -1, 1 },
+        { "SUNIONSTORE", 1, -1, 1 }, { "SINTERSTORE", 1, -1, 1 }, { "SDIFFSTORE", 1, -1, 1 },
+        { "RENAME", 1, 2, 1 }, { "RENAMENX", 1, 2, 1 }, { "SMOVE", 1, 2, 1 },
+        { "RPOPLPUSH", 1, 2, 1 }, { "BRPOPLPUSH", 1, 2, 1 }, { "LMOVE", 1, 2, 1 }, { "BLMOVE", 1, 2, 1 },
+        { "BLPOP", 1, -2, 1 }, { "BRPOP", 1, -2, 1 },
+    };
+
+    bool EqualsNoCase(std::string_view a, const char* b) {
+        size_t i = 0;
+        for (; i < a.size() && b[i] != '\0'; ++i) {
+            if (std::toupper((unsigned char)a[i]) != b[i]) {
+                return false;
+            }
+        }
+        return i == a.size() && b[i] == '\0';
+    }
+
+    //argsΪȫargs[0]keyûkeyֻargs[1]
+    template <typename Iter>
+    bool GetKeysShard(const RedisRing& ring, Iter args, size_t argc, size_t& shard) {
+        shard = 0;
+        if (argc < 2) {
+            return true;
+        }
+        shard = ring.GetNode(args[1]);
+        for (auto& spec : MULTI_KEY_CMDS) {
+            if (!EqualsNoCase(args[0], spec.name)) {
+                continue;
+            }
+            int last = spec.last < 0 ? (int)argc + spec.last : spec.last;
+            for (int i = spec.first + spec.step; i <= last && i < (int)argc; i += spec.step) {
+                if (ring.GetNode(args[i]) != shard) {
+                    return false;
+                }
+            }
+            break;
+        }
+        return true;
+    }
+}
+
+RedisConPool::RedisConPool(size_t poolSize, const std::string& host, int port, const std::string& pwd,
+    int acquireTimeoutMs, int checkIntervalSec)
+    : b_stop_(false), poolSize_(poolSize), host_(host), port_(port), pwd_(pwd),
+    acquireTimeoutMs_(acquireTimeoutMs), checkIntervalSec_(checkIntervalSec), fail_count_(0), timeout_count_(0) {
+    for (auto& count : wait_hist_) {
+        count = 0;
+    }
+    for (size_t i = 0; i < poolSize_; ++i) {
+        auto* context = createConnection();
+        if (context == nullptr) {
+            //ʱҲ߳
+            fail_count_++;
+            continue;
+        }
+        connections_.push(context);
+    }
+    std::cout << "redis pool init " << connections_.size() << "/" << poolSize_ << " connections" << std::endl;
+    check_thread_ = std::thread([this]() {
+        checkThread();
+        });
+}
+
+RedisConPool::~RedisConPool() {
+    Close();
+    if (check_thread_.joinable()) {
+        check_thread_.join();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!connections_.empty()) {
+        redisFree(connections_.front());
+        connections_.pop();
+    }
+}
+
+redisContext* RedisConPool::getConnection() {
+    auto start = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool ready = cond_.wait_for(lock, std::chrono::milliseconds(acquireTimeoutMs_), [this] {
+        if (b_stop_) {
+            return true;
+        }
+        return !connections_.empty();
+        });
+    //ֱֹͣӷؿָ
+    if (b_stop_) {
+        return  nullptr;
+    }
+    if (!ready) {
+        timeout_count_++;
+        std::cout << "get redis connection timeout after " << acquireTimeoutMs_ << "ms" << std::endl;
+        return nullptr;
+    }
+    auto* context = connections_.front();
+    connections_.pop();
+    lock.unlock();
+
+    auto wait_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    int bucket = 0;
+    while (bucket < REDIS_WAIT_BUCKET_NUM - 1 && wait_us >= REDIS_WAIT_BUCKET_US[bucket]) {
+        ++bucket;
+    }
+    wait_hist_[bucket]++;
+    return context;
+}
+
+void RedisConPool::returnConnection(redisContext* context) {
+    //дhirediserrӲ
+    if (context->err != 0) {
+        std::cout << "redis connection broken: " << context->errstr << std::endl;
+        discardConnection(context);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (b_stop_) {
+        redisFree(context);
+        return;
+    }
+    connections_.push(context);
+    cond_.notify_one();
+}
+
+void RedisConPool::discardConnection(redisContext* context) {
+    redisFree(context);
+    fail_count_++;
+    check_cond_.notify_one();
+}
+
+void RedisConPool::Close() {
+    b_stop_ = true;
+    cond_.notify_all();
+    check_cond_.notify_all();
+}
+
+int64_t RedisConPool::GetWaitCount(int bucket) {
+    if (bucket < 0 || bucket >= REDIS_WAIT_BUCKET_NUM) {
+        return 0;
+    }
+    return wait_hist_[bucket];
+}
+
+int64_t RedisConPool::GetTimeoutCount() {
+    return timeout_count_;
+}
+
+int64_t RedisConPool::GetIdleCount() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return connections_.size();
+}
+
+redisContext* RedisConPool::createConnection() {
+    struct timeval connect_tv = { REDIS_CONNECT_TIMEOUT_MS / 1000, (REDIS_CONNECT_TIMEOUT_MS % 1000) * 1000 };
+    auto* context = redisConnectWithTimeout(host_.c_str(), port_, connect_tv);
+    if (context == nullptr || context->err != 0) {
+        std::cout << "connect redis " << host_ << ":" << port_ << " failed";
+        if (context != nullptr) {
+            std::cout << ", error is " << context->errstr;
+            redisFree(context);
+        }
+        std::cout << std::endl;
+        return nullptr;
+    }
+    //ʱӻᱻΪ黹ʱͷ
+    struct timeval command_tv = { REDIS_COMMAND_TIMEOUT_MS / 1000, (REDIS_COMMAND_TIMEOUT_MS % 1000) * 1000 };
+    redisSetTimeout(context, command_tv);
+
+    if (pwd_.empty()) {
+        return context;
+    }
+    auto reply = (redisReply*)redisCommand(context, "AUTH %b", pwd_.data(), pwd_.size());
+    if (reply == nullptr || reply->type == REDIS_REPLY_ERROR) {
+        std::cout << "֤ʧ" << (reply != nullptr ? reply->str : context->errstr) << std::endl;
+        //ͷredisCommandִк󷵻صredisReplyռõڴ
+        freeReplyObject(reply);
+        redisFree(context);
+        return nullptr;
+    }
+    freeReplyObject(reply);
+    std::cout << "֤ɹ" << std::endl;
+    return context;
+}
+
+void RedisConPool::checkThread() {
+    auto last_check = std::chrono::steady_clock::now();
+    auto next_retry = last_check;
+    int backoff_sec = 1;
+    while (!b_stop_) {
+        {
+            std::unique_lock<std::mutex> lock(check_mutex_);
+            check_cond_.wait_for(lock, std::chrono::seconds(1), [this] {
+                return b_stop_.load();
+                });
+        }
+        if (b_stop_) {
+            break;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (checkIntervalSec_ > 0 && now - last_check >= std::chrono::seconds(checkIntervalSec_)) {
+            last_check = now;
+            checkConnectionPro();
+        }
+
+        //ʧʱ1s2s4s...˱ܣREDIS_RECONNECT_MAX_SEC
+        if (fail_count_ > 0 && now >= next_retry) {
+            if (reconnect()) {
+                backoff_sec = 1;
+            }
+            else {
+                next_retry = now + std::chrono::seconds(backoff_sec);
+                backoff_sec = (std::min)(backoff_sec * 2, REDIS_RECONNECT_MAX_SEC);
+            }
+        }
+    }
+}
+
+void RedisConPool::checkConnectionPro() {
+    //ȶȡҪڼ黹Ӳظ
+    size_t targetCount;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        targetCount = connections_.size();
+    }
+
+    for (size_t processed = 0; processed < targetCount; ++processed) {
+        redisContext* context = nullptr;
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (connections_.empty() || b_stop_) {
+                break;
+            }
+            context = connections_.front();
+            connections_.pop();
+        }
+
+        //PINGӰ߳ȡ
+        auto reply = (redisReply*)redisCommand(context, "PING");
+        bool healthy = reply != nullptr && reply->type != REDIS_REPLY_ERROR;
+        freeReplyObject(reply);
+        if (!healthy) {
+            std::cout << "redis connection ping failed" << std::endl;
+            redisFree(context);
+            fail_count_++;
+            continue;
+        }
+        returnConnection(context);
+    }
+}
+
+bool RedisConPool::reconnect() {
+    while (fail_count_ > 0 && !b_stop_) {
+        auto* context = createConnection();
+        if (context == nullptr) {
+            return false;
+        }
+        fail_count_--;
+        std::cout << "redis connection reconnect success" << std::endl;
+        returnConnection(context);
+    }
+    return true;
+}
 
 RedisMgr::RedisMgr()
 {
     auto& gCfgMgr = ConfigMgr::Inst();
-    auto host = gCfgMgr["Redis"]["Host"];
-    auto port = gCfgMgr["Redis"]["Port"];
     auto pwd = gCfgMgr["Redis"]["pwd"];
-    _con_pool.reset(new RedisConPool(5, host.c_str(), atoi(port.c_str()), pwd.c_str()));
+    auto size_str = gCfgMgr["Redis"]["PoolSize"];
+    auto timeout_str = gCfgMgr["Redis"]["AcquireTimeoutMs"];
+    auto check_str = gCfgMgr["Redis"]["CheckInterval"];
+    size_t pool_size = size_str.empty() ? 5 : std::stoul(size_str);
+    int acquire_timeout = timeout_str.empty() ? 1000 : std::stoi(timeout_str);
+    int check_interval = check_str.empty() ? 30 : std::stoi(check_str);
+    auto addrs = LoadAddrs();
+    for (size_t i = 0; i < addrs.size(); ++i) {
+        _con_pools.emplace_back(new RedisConPool(pool_size, addrs[i].host, addrs[i].port, pwd, acquire_timeout, check_interval));
+        _ring.AddNode(i, addrs[i].host + ":" + std::to_string(addrs[i].port));
+    }
 }
 RedisMgr::~RedisMgr()
 {
     Close();
 }
 
+//ӳͳΪʵ֮
+int64_t RedisMgr::GetPoolWaitCount(int bucket)
+{
+    int64_t count = 0;
+    for (auto& pool : _con_pools) {
+        count += pool->GetWaitCount(bucket);
+    }
+    return count;
+}
 
-bool RedisMgr::Get(const std::string& key, std::string& value)
+int64_t RedisMgr::GetPoolTimeoutCount()
 {
-    auto connect = _con_pool->getConnection();
-    if (connect==nullptr)
-    {
-        return false;
+    int64_t count = 0;
+    for (auto& pool : _con_pools) {
+        count += pool->GetTimeoutCount();
     }
-    // ǰ׺ "code_" 
-    //std::string prefixedKey = "code_" + key;
+    return count;
+}
 
-    auto reply = (redisReply*)redisCommand(connect, "GET %s", key.c_str());
+int64_t RedisMgr::GetPoolIdleCount()
+{
+    int64_t count = 0;
+    for (auto& pool : _con_pools) {
+        count += pool->GetIdleCount();
+    }
+    return count;
+}
 
-    if (reply == NULL) {
-        std::cout << "[GET " << key << "] failed. Error: " << connect->errstr << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
-        return false;
+void RedisRing::AddNode(size_t node, const std::string& name)
+{
+    for (int i = 0; i < REDIS_RING_REPLICAS; ++i) {
+        ring_[Hash(name + "#" + std::to_string(i))] = node;
     }
-    if (reply->type != REDIS_REPLY_STRING) {
-        std::cout << "[GET " << key << "] failed. Unexpected reply type: " << reply->type << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
-        return false;
+    node_num_++;
+}
+
+size_t RedisRing::GetNode(std::string_view key) const
+{
+    if (node_num_ <= 1) {
+        return 0;
     }
-    value = reply->str;
-    freeReplyObject(reply);
+    auto route_key = RouteKey(key);
+    if (route_key.empty()) {
+        return 0;
+    }
+    //˳ʱҵһڵ
+    auto iter = ring_.lower_bound(Hash(route_key));
+    if (iter == ring_.end()) {
+        iter = ring_.begin();
+    }
+    return iter->second;
+}
 
+std::string_view RedisRing::RouteKey(std::string_view key)
+{
+    //redis clusterһ£ȡһ{}еķǿ
+    auto left = key.find('{');
+    if (left != std::string_view::npos) {
+        auto right = key.find('}', left + 1);
+        if (right != std::string_view::npos && right > left + 1) {
+            return key.substr(left + 1, right - left - 1);
+        }
+    }
+    //utoken_uip_ubaseinfo_usession_Ȱĩβuid·
+    auto pos = key.find_last_of('_');
+    if (pos == std::string_view::npos || pos + 1 == key.size()) {
+        return std::string_view();
+    }
+    auto suffix = key.substr(pos + 1);
+    for (auto ch : suffix) {
+        if (ch < '0' || ch > '9') {
+            return std::string_view();
+        }
+    }
+    return suffix;
+}
 
-    std::cout << "Succeed to execute command [ GET " << key << "  ]" << std::endl;
-    _con_pool->returnConnection(connect);
-    return true;
+uint32_t RedisRing::Hash(std::string_view data)
+{
+    //FNV-1a͸ƽ̨Ͻһ
+    uint32_t hash = 2166136261u;
+    for (auto ch : data) {
+        hash ^= (uint8_t)ch;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+std::vector<RedisAddr> RedisMgr::LoadAddrs()
+{
+    auto& gCfgMgr = ConfigMgr::Inst();
+    std::vector<RedisAddr> addrs;
+    std::string hosts = gCfgMgr["Redis"]["Hosts"];
+    size_t begin = 0;
+    while (begin < hosts.size()) {
+        auto end = hosts.find(',', begin);
+        if (end == std::string::npos) {
+            end = hosts.size();
+        }
+        auto item = hosts.substr(begin, end - begin);
+        begin = end + 1;
+        //ȥеĿո
+        item.erase(std::remove(item.begin(), item.end(), ' '), item.end());
+        auto colon = item.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        addrs.push_back({ item.substr(0, colon), atoi(item.c_str() + colon + 1) });
+    }
+    if (addrs.empty()) {
+        addrs.push_back({ gCfgMgr["Redis"]["Host"], atoi(gCfgMgr["Redis"]["Port"].c_str()) });
+    }
+    return addrs;
 }
 
-bool RedisMgr::Set(const std::string& key, const std::string& value)
+size_t RedisMgr::GetShard(std::string_view key)
 {
+    return _ring.GetNode(key);
+}
 
-    auto connect = _con_pool->getConnection();
+bool RedisMgr::GetShard(const RedisCmd& cmd, size_t& shard)
+{
+    //ûkeyһʵ
+    return GetKeysShard(_ring, cmd.begin(), cmd.size(), shard);
+}
+
+
+RedisReplyPtr RedisMgr::Command(std::initializer_list<std::string_view> args)
+{
+    const char* argv[16];
+    size_t argvlen[16];
+    if (args.size() == 0 || args.size() > 16) {
+        return nullptr;
+    }
+    int argc = 0;
+    for (auto& arg : args) {
+        argv[argc] = arg.data();
+        argvlen[argc] = arg.size();
+        ++argc;
+    }
+    size_t shard = 0;
+    if (!GetKeysShard(_ring, args.begin(), args.size(), shard)) {
+        std::cout << "Execut command [ " << *args.begin() << " ] failure ! keys in different shards" << std::endl;
+        return nullptr;
+    }
+    auto& pool = _con_pools[shard];
+    auto connect = pool->getConnection();
     if (connect == nullptr)
     {
-        return false;
+        return nullptr;
     }
-   //ִredis
-    auto reply = (redisReply*)redisCommand(connect, "SET %s %s", key.c_str(), value.c_str());
-    //NULL˵ִʧ
-    if (NULL==reply)
-    {
-        std::cout << "Execut command [ SET " << key << "  " << value << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
-        return false;
+    //ȴΣپʽֵַеĿո\0ԭд
+    RedisReplyPtr reply((redisReply*)redisCommandArgv(connect, argc, argv, argvlen));
+    if (reply == nullptr) {
+        std::cout << "Execut command [ " << *args.begin() << " ] failure ! Error: " << connect->errstr << std::endl;
     }
+    pool->returnConnection(connect);
+    return reply;
+}
 
-    //ִʧͷ
-    if (!(reply->type == REDIS_REPLY_STATUS && (strcmp(reply->str, "OK") == 0
-        || strcmp(reply->str, "ok") == 0))) {
-        std::cout << "Execut command [ SET " << key << "  " << value << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+bool RedisMgr::Get(std::string_view key, std::string& value)
+{
+    RedisReplyPtr reply;
+    if (!Get(key, reply)) {
         return false;
     }
-
-    //ִгɹ ͷrediscommandִк󷵻replyռõڴ
-    freeReplyObject(reply);
-    std::cout << "Execut command [ SET " << key << "  " << value << " ] success ! " << std::endl;
-    _con_pool->returnConnection(connect);
+    value.assign(reply->str, reply->len);
     return true;
 }
 
-bool RedisMgr::Auth(const std::string& password)
+bool RedisMgr::Get(std::string_view key, RedisReplyPtr& reply)
 {
-    auto connect = _con_pool->getConnection();
-    if (connect == nullptr)
-    {
+    reply = Command({ "GET", key });
+    if (reply == nullptr) {
+        std::cout << "[GET " << key << "] failed." << std::endl;
         return false;
     }
-    auto reply = (redisReply*)redisCommand(connect, "AUTH %s", password.c_str());
-    if (reply->type == REDIS_REPLY_ERROR) {
-        std::cout << "֤ʧ" << std::endl;
-        //ִгɹ ͷredisCommandִк󷵻صredisReplyռõڴ
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+    if (reply->type != REDIS_REPLY_STRING) {
+        std::cout << "[GET " << key << "] failed. Unexpected reply type: " << reply->type << std::endl;
+        reply.reset();
         return false;
     }
-    else {
-        //ִгɹ ͷredisCommandִк󷵻صredisReplyռõڴ
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
-        std::cout << "֤ɹ" << std::endl;
-        return true;
-    }
+
+    std::cout << "Succeed to execute command [ GET " << key << "  ]" << std::endl;
+    return true;
 }
 
-bool RedisMgr::LPush(const std::string& key, const std::string& value)
+bool RedisMgr::Set(std::string_view key, std::string_view value)
 {
-    auto connect = _con_pool->getConnection();
-    if (connect == nullptr)
-    {
-        return false;
-    }
-   auto reply = (redisReply*)redisCommand(connect, "LPUSH %s %s", key.c_str(), value.c_str());
-    if (NULL == reply)
-    {
-        std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+    //ִredis
+    auto reply = Command({ "SET", key, value });
+    //ؿջ߲OK˵ִʧܣֵǶݣ־ֻӡ
+    if (reply == nullptr || !(reply->type == REDIS_REPLY_STATUS && (strcmp(reply->str, "OK") == 0
+        || strcmp(reply->str, "ok") == 0))) {
+        std::cout << "Execut command [ SET " << key << "  " << value.size() << " bytes ] failure ! " << std::endl;
         return false;
     }
-    if (reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
-        std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+
+    std::cout << "Execut command [ SET " << key << "  " << value.size() << " bytes ] success ! " << std::endl;
+    return true;
+}
+
+bool RedisMgr::Auth(std::string_view password)
+{
+    auto reply = Command({ "AUTH", password });
+    if (reply == nullptr || reply->type == REDIS_REPLY_ERROR) {
+        std::cout << "֤ʧ" << std::endl;
         return false;
     }
-    std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] success ! " << std::endl;
-    freeReplyObject(reply);
-    _con_pool->returnConnection(connect);
+    std::cout << "֤ɹ" << std::endl;
     return true;
 }
 
-bool RedisMgr::LPop(const std::string& key, std::string& value)
+bool RedisMgr::LPush(std::string_view key, std::string_view value)
 {
-    auto connect = _con_pool->getConnection();
-    if (connect == nullptr)
-    {
+    auto reply = Command({ "LPUSH", key, value });
+    if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
+        std::cout << "Execut command [ LPUSH " << key << "  " << value.size() << " bytes ] failure ! " << std::endl;
         return false;
     }
-    auto reply = (redisReply*)redisCommand(connect, "LPOP %s ", key.c_str());
-    if (reply == nullptr || reply->type == REDIS_REPLY_NIL) {
+    std::cout << "Execut command [ LPUSH " << key << "  " << value.size() << " bytes ] success ! " << std::endl;
+    return true;
+}
+
+bool RedisMgr::LPop(std::string_view key, std::string& value)
+{
+    auto reply = Command({ "LPOP", key });
+    if (reply == nullptr || reply->type != REDIS_REPLY_STRING) {
         std::cout << "Execut command [ LPOP " << key << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
         return false;
     }
-    value = reply->str;
+    value.assign(reply->str, reply->len);
     std::cout << "Execut command [ LPOP " << key << " ] success ! " << std::endl;
-    freeReplyObject(reply);
-    _con_pool->returnConnection(connect);
     return true;
 }
 
-bool RedisMgr::RPush(const std::string& key, const std::string& value)
+bool RedisMgr::RPush(std::string_view key, std::string_view value)
 {
-    auto connect = _con_pool->getConnection();
-    if (connect == nullptr)
-    {
+    auto reply = Command({ "RPUSH", key, value });
+    if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
+        std::cout << "Execut command [ RPUSH " << key << "  " << value.size() << " bytes ] failure ! " << std::endl;
         return false;
     }
-    auto reply = (redisReply*)redisCommand(connect, "RPUSH %s %s", key.c_str(), value.c_str());
-    if (NULL == reply)
-    {
-        std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+    std::cout << "Execut command [ RPUSH " << key << "  " << value.size() << " bytes ] success ! " << std::endl;
+    return true;
+}
+
+bool RedisMgr::RPop(std::string_view key, std::string& value)
+{
+    auto reply = Command({ "RPOP", key });
+    if (reply == nullptr || reply->type != REDIS_REPLY_STRING) {
+        std::cout << "Execut command [ RPOP " << key << " ] failure ! " << std::endl;
         return false;
     }
-    if (reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
-        std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+    value.assign(reply->str, reply->len);
+    std::cout << "Execut command [ RPOP " << key << " ] success ! " << std::endl;
+    return true;
+}
+
+bool RedisMgr::HSet(std::string_view key, std::string_view hkey, std::string_view value)
+{
+    auto reply = Command({ "HSET", key, hkey, value });
+    if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER) {
+        std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value.size() << " bytes ] failure ! " << std::endl;
         return false;
     }
-    std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] success ! " << std::endl;
-    freeReplyObject(reply);
-    _con_pool->returnConnection(connect);
+    std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value.size() << " bytes ] success ! " << std::endl;
     return true;
 }
 
-bool RedisMgr::RPop(const std::string& key, std::string& value)
+bool RedisMgr::HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen)
 {
-    auto connect = _con_pool->getConnection();
-    if (connect == nullptr)
-    {
-        return false;
+    return HSet(std::string_view(key), std::string_view(hkey), std::string_view(hvalue, hvaluelen));
+}
+
+std::string RedisMgr::HGet(std::string_view key, std::string_view hkey)
+{
+    auto reply = Command({ "HGET", key, hkey });
+    if (reply == nullptr || reply->type != REDIS_REPLY_STRING) {
+        std::cout << "Execut command [ HGet " << key << " " << hkey << "  ] failure ! " << std::endl;
+        return "";
     }
-    auto reply = (redisReply*)redisCommand(connect, "RPOP %s ", key.c_str());
-    if (reply == nullptr || reply->type == REDIS_REPLY_NIL) {
-        std::cout << "Execut command [ RPOP " << key << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+    std::cout << "Execut command [ HGet " << key << " " << hkey << " ] success ! " << std::endl;
+    return std::string(reply->str, reply->len);
+}
+
+bool RedisMgr::HIncrBy(std::string_view key, std::string_view hkey, long long delta, long long* result)
+{
+    auto delta_str = std::to_string(delta);
+    auto reply = Command({ "HINCRBY", key, hkey, delta_str });
+    if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER) {
+        std::cout << "Execut command [ HIncrBy " << key << " " << hkey << " " << delta << " ] failure ! " << std::endl;
         return false;
     }
-    value = reply->str;
-    std::cout << "Execut command [ RPOP " << key << " ] success ! " << std::endl;
-    freeReplyObject(reply);
-    _con_pool->returnConnection(connect);
+    if (result != nullptr) {
+        *result = reply->integer;
+    }
+    std::cout << "Execut command [ HIncrBy " << key << " " << hkey << " " << delta << " ] success ! " << std::endl;
     return true;
 }
 
-bool RedisMgr::HSet(const std::string& key, const std::string& hkey, const std::string& value)
+bool RedisMgr::Del(std::string_view key)
 {
-    auto connect = _con_pool->getConnection();
-    if (connect == nullptr)
-    {
-        return "";
-    }
-    auto reply = (redisReply*)redisCommand(connect, "HSET %s %s %s", key.c_str(), hkey.c_str(), value.c_str());
+    auto reply = Command({ "DEL", key });
     if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER) {
-        std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+        std::cout << "Execut command [ Del " << key << " ] failure ! " << std::endl;
         return false;
     }
-    std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] success ! " << std::endl;
-    freeReplyObject(reply);
-    _con_pool->returnConnection(connect);
+    std::cout << "Execut command [ Del " << key << " ] success ! " << std::endl;
     return true;
 }
-bool RedisMgr::HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen)
+
+bool RedisMgr::ExistsKey(std::string_view key)
 {
-    const char* argv[4];
-    size_t argvlen[4];
-    argv[0] = "HSET";
-    argvlen[0] = 4;
-    argv[1] = key;
-    argvlen[1] = strlen(key);
-    argv[2] = hkey;
-    argvlen[2] = strlen(hkey);
-    argv[3] = hvalue;
-    argvlen[3] = hvaluelen;
-    auto connect = _con_pool->getConnection();
-    if (connect == nullptr)
-    {
+    auto reply = Command({ "EXISTS", key });
+    if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER || reply->integer == 0) {
+        std::cout << "Not Found [ Key " << key << " ]  ! " << std::endl;
         return false;
     }
-    auto reply = (redisReply*)redisCommandArgv(connect, 4, argv, argvlen);
-    if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER) {
-        std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+    std::cout << " Found [ Key " << key << " ] exists ! " << std::endl;
+    return true;
+}
+
+void RedisMgr::Close()
+{
+    for (auto& pool : _con_pools) {
+        pool->Close();
+    }
+}
+
+bool RedisMgr::MGet(const std::vector<std::string>& keys, std::vector<std::string>& values, std::vector<bool>& exists)
+{
+    values.assign(keys.size(), "");
+    exists.assign(keys.size(), false);
+    if (keys.empty()) {
+        return true;
+    }
+    //ʵɶMGETÿĵһkey·
+    std::vector<std::vector<size_t>> groups(_con_pools.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        groups[GetShard(keys[i])].push_back(i);
+    }
+    std::vector<RedisCmd> cmds;
+    std::vector<const std::vector<size_t>*> cmd_groups;
+    for (auto& group : groups) {
+        if (group.empty()) {
+            continue;
+        }
+        RedisCmd cmd;
+        cmd.reserve(group.size() + 1);
+        cmd.push_back("MGET");
+        for (auto index : group) {
+            cmd.push_back(keys[index]);
+        }
+        cmds.push_back(std::move(cmd));
+        cmd_groups.push_back(&group);
+    }
+
+    std::vector<RedisReplyPtr> replies;
+    if (!Pipeline(cmds, replies)) {
         return false;
     }
-    std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] success ! " << std::endl;
-    freeReplyObject(reply);
-    _con_pool->returnConnection(connect);
+    for (size_t i = 0; i < replies.size(); ++i) {
+        auto& reply = replies[i];
+        auto& group = *cmd_groups[i];
+        if (reply->type != REDIS_REPLY_ARRAY || reply->elements != group.size()) {
+            std::cout << "Execut command [ MGET " << keys.size() << " keys ] failure ! " << std::endl;
+            return false;
+        }
+        for (size_t j = 0; j < group.size(); ++j) {
+            exists[group[j]] = ReplyToString(reply->element[j], values[group[j]]);
+        }
+    }
     return true;
 }
 
-std::string RedisMgr::HGet(const std::string& key, const std::string& hkey)
+bool RedisMgr::Pipeline(const std::vector<RedisCmd>& cmds, std::vector<RedisReplyPtr>& replies)
 {
-    const char* argv[3];
-    size_t argvlen[3];
-    argv[0] = "HGET";
-    argvlen[0] = 4;
-    argv[1] = key.c_str();
-    argvlen[1] = key.length();
-    argv[2] = hkey.c_str();
-    argvlen[2] = hkey.length();
-    auto connect = _con_pool->getConnection();
-    if (connect == nullptr)
-    {
-        return "";
+    replies.clear();
+    if (cmds.empty()) {
+        return true;
     }
-    auto reply = (redisReply*)redisCommandArgv(connect, 3, argv, argvlen);
-    if (reply == nullptr || reply->type == REDIS_REPLY_NIL) {
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
-        std::cout << "Execut command [ HGet " << key << " " << hkey << "  ] failure ! " << std::endl;
-        return "";
+    //ʵ飬ÿʵһظٰԭ˳Ż
+    //keykeyʵʱܾʵMGETMGet
+    std::vector<std::vector<size_t>> groups(_con_pools.size());
+    for (size_t i = 0; i < cmds.size(); ++i) {
+        size_t shard = 0;
+        if (!GetShard(cmds[i], shard)) {
+            std::cout << "Execut command [ " << cmds[i][0] << " ] failure ! keys in different shards" << std::endl;
+            return false;
+        }
+        groups[shard].push_back(i);
     }
-    std::string value = reply->str;
-    freeReplyObject(reply);
-    _con_pool->returnConnection(connect);
-    std::cout << "Execut command [ HGet " << key << " " << hkey << " ] success ! " << std::endl;
-    return value;
+    replies.resize(cmds.size());
+    bool success = true;
+    for (size_t shard = 0; shard < groups.size(); ++shard) {
+        auto& group = groups[shard];
+        if (group.empty()) {
+            continue;
+        }
+        std::vector<const RedisCmd*> shard_cmds;
+        shard_cmds.reserve(group.size());
+        for (auto index : group) {
+            shard_cmds.push_back(&cmds[index]);
+        }
+        std::vector<RedisReplyPtr> shard_replies;
+        if (!PipelineOn(shard, shard_cmds, shard_replies)) {
+            success = false;
+        }
+        for (size_t i = 0; i < shard_replies.size(); ++i) {
+            replies[group[i]] = std::move(shard_replies[i]);
+        }
+    }
+    return success;
 }
 
-bool RedisMgr::Del(const std::string& key)
+bool RedisMgr::Transaction(const std::vector<RedisCmd>& cmds, std::vector<RedisReplyPtr>& replies)
 {
-    auto connect = _con_pool->getConnection();
-    if (connect == nullptr)
-    {
+    replies.clear();
+    if (cmds.empty()) {
+        return true;
+    }
+    //ֻһʵִУҪkey·ɵͬһʵ{tag}֤
+    size_t shard = 0;
+    for (size_t i = 0; i < cmds.size(); ++i) {
+        size_t cmd_shard = 0;
+        if (!GetShard(cmds[i], cmd_shard) || (i > 0 && cmd_shard != shard)) {
+            std::cout << "Execut command [ MULTI/EXEC ] failure ! keys in different shards" << std::endl;
+            return false;
+        }
+        shard = cmd_shard;
+    }
+    RedisCmd multi_cmd = { "MULTI" };
+    RedisCmd exec_cmd = { "EXEC" };
+    std::vector<const RedisCmd*> multi_cmds;
+    multi_cmds.reserve(cmds.size() + 2);
+    multi_cmds.push_back(&multi_cmd);
+    for (auto& cmd : cmds) {
+        multi_cmds.push_back(&cmd);
+    }
+    multi_cmds.push_back(&exec_cmd);
+
+    std::vector<RedisReplyPtr> all_replies;
+    if (!PipelineOn(shard, multi_cmds, all_replies)) {
         return false;
     }
-    auto reply = (redisReply*)redisCommand(connect, "DEL %s", key.c_str());
-    if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER) {
-        std::cout << "Execut command [ Del " << key << " ] failure ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+    //EXECnil˵񱻷ʱΪÿĽ
+    auto& exec_reply = all_replies.back();
+    if (exec_reply->type != REDIS_REPLY_ARRAY || exec_reply->elements != cmds.size()) {
+        std::cout << "Execut command [ MULTI/EXEC " << cmds.size() << " cmds ] failure ! " << std::endl;
         return false;
     }
-    std::cout << "Execut command [ Del " << key << " ] success ! " << std::endl;
-    freeReplyObject(reply);
-    _con_pool->returnConnection(connect);
+    //ӻظEXECժ
+    for (size_t i = 0; i < exec_reply->elements; ++i) {
+        replies.emplace_back(exec_reply->element[i]);
+        exec_reply->element[i] = nullptr;
+    }
     return true;
 }
 
-bool RedisMgr::ExistsKey(const std::string& key)
+bool RedisMgr::PipelineOn(size_t shard, const std::vector<const RedisCmd*>& cmds, std::vector<RedisReplyPtr>& replies)
 {
-    auto connect = _con_pool->getConnection();
+    auto& pool = _con_pools[shard];
+    auto connect = pool->getConnection();
     if (connect == nullptr)
     {
         return false;
     }
-    auto reply = (redisReply*)redisCommand(connect, "exists %s", key.c_str());
-    if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER || reply->integer == 0) {
-        std::cout << "Not Found [ Key " << key << " ]  ! " << std::endl;
-        freeReplyObject(reply);
-        _con_pool->returnConnection(connect);
+    //Ȱд壬ȡһظʱһԷ
+    for (auto cmd : cmds) {
+        if (!AppendCommand(connect, *cmd)) {
+            //ǰѾд壬Żӳػᱻһʹһ𷢳
+            std::cout << "Execut pipeline append failure ! " << std::endl;
+            pool->discardConnection(connect);
+            return false;
+        }
+    }
+    bool success = GetReplies(connect, cmds.size(), replies);
+    pool->returnConnection(connect);
+    return success;
+}
+
+bool RedisMgr::ReplyToString(const redisReply* reply, std::string& value)
+{
+    std::string_view view;
+    if (!ReplyToView(reply, view)) {
         return false;
     }
-    std::cout << " Found [ Key " << key << " ] exists ! " << std::endl;
-    freeReplyObject(reply);
-    _con_pool->returnConnection(connect);
+    value.assign(view.data(), view.size());
     return true;
 }
 
-void RedisMgr::Close()
+bool RedisMgr::ReplyToView(const redisReply* reply, std::string_view& view)
 {
-    _con_pool->Close();
+    if (reply == nullptr) {
+        return false;
+    }
+    if (reply->type != REDIS_REPLY_STRING && reply->type != REDIS_REPLY_STATUS) {
+        return false;
+    }
+    view = std::string_view(reply->str, reply->len);
+    return true;
 }
 
+bool RedisMgr::AppendCommand(redisContext* connect, const RedisCmd& cmd)
+{
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+    argv.reserve(cmd.size());
+    argvlen.reserve(cmd.size());
+    for (auto& arg : cmd) {
+        argv.push_back(arg.data());
+        argvlen.push_back(arg.size());
+    }
+    return redisAppendCommandArgv(connect, (int)cmd.size(), argv.data(), argvlen.data()) == REDIS_OK;
+}
 
+bool RedisMgr::GetReplies(redisContext* connect, size_t count, std::vector<RedisReplyPtr>& replies)
+{
+    //ʹмҲҪлظϻδ
+    bool success = true;
+    for (size_t i = 0; i < count; ++i) {
+        void* reply = nullptr;
+        if (redisGetReply(connect, &reply) != REDIS_OK || reply == nullptr) {
+            std::cout << "Execut pipeline failure ! Error: " << connect->errstr << std::endl;
+            return false;
+        }
+        replies.emplace_back((redisReply*)reply);
+        if (replies.back()->type == REDIS_REPLY_ERROR) {
+            std::cout << "Execut pipeline command " << i << " error: " << replies.back()->str << std::endl;
+            success = false;
+        }
+    }
+    return success;
+}
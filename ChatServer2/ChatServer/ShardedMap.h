@@ -0,0 +1,119 @@
+#pragma once
+#include "const.h"
+#include <vector>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <functional>
+
+//ֶμĲϣkeyĹϣֵֵΣÿһѶд
+//ֻڶεĶ֮ͬĲɾӰ
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedMap
+{
+public:
+	explicit ShardedMap(std::size_t shard_num = SESSION_SHARD_NUM) :_shard_mask(0) {
+		//ȡ2ݣ붨λ
+		std::size_t size = 1;
+		while (size < shard_num) {
+			size <<= 1;
+		}
+		_shards.reserve(size);
+		for (std::size_t i = 0; i < size; ++i) {
+			_shards.emplace_back(new Shard());
+		}
+		_shard_mask = size - 1;
+	}
+
+	ShardedMap(const ShardedMap&) = delete;
+	ShardedMap& operator=(const ShardedMap&) = delete;
+
+	bool Find(const Key& key, Value& value) {
+		auto& shard = GetShard(key);
+		std::shared_lock<std::shared_mutex> lock(shard._mutex);
+		auto iter = shard._map.find(key);
+		if (iter == shard._map.end()) {
+			return false;
+		}
+		value = iter->second;
+		return true;
+	}
+
+	//򸲸
+	void Set(const Key& key, Value value) {
+		auto& shard = GetShard(key);
+		std::unique_lock<std::shared_mutex> lock(shard._mutex);
+		shard._map[key] = std::move(value);
+	}
+
+	//ɾkeyɾǰֵͨold_value
+	bool Erase(const Key& key, Value* old_value = nullptr) {
+		auto& shard = GetShard(key);
+		std::unique_lock<std::shared_mutex> lock(shard._mutex);
+		auto iter = shard._map.find(key);
+		if (iter == shard._map.end()) {
+			return false;
+		}
+		if (old_value != nullptr) {
+			*old_value = std::move(iter->second);
+		}
+		shard._map.erase(iter);
+		return true;
+	}
+
+	//predtrueʱɾжϺɾͬһ
+	template<typename Pred>
+	bool EraseIf(const Key& key, Pred pred) {
+		auto& shard = GetShard(key);
+		std::unique_lock<std::shared_mutex> lock(shard._mutex);
+		auto iter = shard._map.find(key);
+		if (iter == shard._map.end() || !pred(iter->second)) {
+			return false;
+		}
+		shard._map.erase(iter);
+		return true;
+	}
+
+	//αĳʱֻиöεĶ
+	template<typename Func>
+	void ForEach(Func func) {
+		for (auto& shard : _shards) {
+			std::shared_lock<std::shared_mutex> lock(shard->_mutex);
+			for (auto& iter : shard->_map) {
+				func(iter.first, iter.second);
+			}
+		}
+	}
+
+	std::size_t Size() {
+		std::size_t size = 0;
+		for (auto& shard : _shards) {
+			std::shared_lock<std::shared_mutex> lock(shard->_mutex);
+			size += shard->_map.size();
+		}
+		return size;
+	}
+
+	void Clear() {
+		for (auto& shard : _shards) {
+			std::unique_lock<std::shared_mutex> lock(shard->_mutex);
+			shard->_map.clear();
+		}
+	}
+
+private:
+	//ÿε䲢ж룬ڶεα
+	struct alignas(64) Shard {
+		std::shared_mutex _mutex;
+		std::unordered_map<Key, Value, Hash> _map;
+	};
+
+	Shard& GetShard(const Key& key) {
+		//keystd::hashԭֵ˷ɢкȡλuid䵽
+		uint64_t hash = static_cast<uint64_t>(Hash()(key)) * 0x9E3779B97F4A7C15ull;
+		return *_shards[(hash >> 32) & _shard_mask];
+	}
+
+	std::vector<std::unique_ptr<Shard>> _shards;
+	std::size_t _shard_mask;
+};
@@ -0,0 +1,99 @@
+#include "StatsMgr.h"
+#include "ConfigMgr.h"
+#include "AsyncRedis.h"
+
+StatsMgr::StatsMgr() :_interval(10)
+{
+	auto interval_str = ConfigMgr::Inst().GetValue("Stats", "Interval");
+	if (!interval_str.empty()) {
+		_interval = std::stoi(interval_str);
+	}
+}
+
+StatsMgr::~StatsMgr()
+{
+	std::cout << "StatsMgr destruct" << std::endl;
+}
+
+void StatsMgr::RegCollector(const std::string& name, std::function<int64_t()> collector)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_collectors[name] = collector;
+}
+
+void StatsMgr::Start(boost::asio::io_context& io_context)
+{
+	if (_interval <= 0) {
+		return;
+	}
+	_timer = std::make_unique<boost::asio::steady_timer>(io_context);
+	StartTimer();
+}
+
+void StatsMgr::StartTimer()
+{
+	_timer->expires_after(std::chrono::seconds(_interval));
+	_timer->async_wait([this](const boost::system::error_code& ec) {
+		if (ec) {
+			return;
+		}
+		Report();
+		StartTimer();
+		});
+}
+
+void StatsMgr::Report()
+{
+	std::map<std::string, int64_t> values;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		for (auto& collector : _collectors) {
+			values[collector.first] = collector.second();
+		}
+	}
+
+	auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
+	std::string stats_key = STATS_PREFIX + server_name;
+	std::cout << "[stats] ";
+	for (auto& value : values) {
+		auto value_str = std::to_string(value.second);
+		std::cout << value.first << "=" << value_str << " ";
+		//ϱioִ߳Уȴredis
+		AsyncRedis::GetInstance()->Command({ "HSET", stats_key, value.first, value_str });
+	}
+	std::cout << std::endl;
+}
+
+LatencyHistogram::LatencyHistogram()
+{
+	for (auto& count : _counts) {
+		count = 0;
+	}
+}
+
+void LatencyHistogram::Record(int64_t latency_us)
+{
+	int bucket = 0;
+	while (bucket < LATENCY_BUCKET_NUM - 1 && latency_us >= LATENCY_BUCKET_US[bucket]) {
+		++bucket;
+	}
+	_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::GetCount(int bucket)
+{
+	if (bucket < 0 || bucket >= LATENCY_BUCKET_NUM) {
+		return 0;
+	}
+	return _counts[bucket].load(std::memory_order_relaxed);
+}
+
+void LatencyHistogram::Register(const std::string& prefix)
+{
+	const char* names[LATENCY_BUCKET_NUM] = { "500us", "1ms", "5ms", "20ms", "100ms", "inf" };
+	for (int i = 0; i < LATENCY_BUCKET_NUM; ++i) {
+		StatsMgr::GetInstance()->RegCollector(prefix + "_" + names[i], [this, i]() {
+			return GetCount(i);
+			});
+	}
+}
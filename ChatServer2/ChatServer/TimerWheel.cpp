@@ -0,0 +1,100 @@
+#include "TimerWheel.h"
+#include "CSession.h"
+
+TimerWheel::TimerWheel(boost::asio::io_context& io_context, int timeout_sec)
+	:_io_context(io_context), _timer(io_context), _timeout_sec(timeout_sec), _tick(0)
+{
+	//ڶܸǵʱ
+	int max_timeout = TIMER_WHEEL_SLOTS * (TIMER_WHEEL_SLOTS - 1);
+	if (_timeout_sec > max_timeout) {
+		_timeout_sec = max_timeout;
+	}
+}
+
+TimerWheel::~TimerWheel()
+{
+	std::cout << "TimerWheel destruct" << std::endl;
+}
+
+void TimerWheel::Start()
+{
+	StartTimer();
+}
+
+void TimerWheel::AddSession(std::shared_ptr<CSession> session)
+{
+	Insert(session, std::time(nullptr));
+}
+
+void TimerWheel::StartTimer()
+{
+	_timer.expires_after(std::chrono::seconds(1));
+	_timer.async_wait([this](const boost::system::error_code& ec) {
+		if (ec) {
+			return;
+		}
+		Tick();
+		StartTimer();
+		});
+}
+
+bool TimerWheel::Insert(std::weak_ptr<CSession> session, time_t now)
+{
+	auto session_ptr = session.lock();
+	//ỰѾͷŻرգʱƳ
+	if (session_ptr == nullptr || session_ptr->IsClosed()) {
+		return true;
+	}
+
+	time_t deadline = session_ptr->GetLastHeartbeat() + _timeout_sec;
+	if (deadline <= now) {
+		return false;
+	}
+
+	uint64_t delay = deadline - now;
+	uint64_t expire = _tick + delay;
+	if (delay < TIMER_WHEEL_SLOTS) {
+		_near[expire % TIMER_WHEEL_SLOTS].push_back(session);
+	}
+	else {
+		_far[(expire / TIMER_WHEEL_SLOTS) % TIMER_WHEEL_SLOTS].push_back(session);
+	}
+	return true;
+}
+
+void TimerWheel::Cascade()
+{
+	//һתһȦѵڶǰ۵ĻỰ·䵽һ
+	std::vector<std::weak_ptr<CSession>> sessions;
+	sessions.swap(_far[(_tick / TIMER_WHEEL_SLOTS) % TIMER_WHEEL_SLOTS]);
+	time_t now = std::time(nullptr);
+	for (auto& session : sessions) {
+		if (!Insert(session, now)) {
+			auto session_ptr = session.lock();
+			if (session_ptr != nullptr) {
+				session_ptr->CloseIdle();
+			}
+		}
+	}
+}
+
+void TimerWheel::Tick()
+{
+	++_tick;
+	if (_tick % TIMER_WHEEL_SLOTS == 0) {
+		Cascade();
+	}
+
+	std::vector<std::weak_ptr<CSession>> sessions;
+	sessions.swap(_near[_tick % TIMER_WHEEL_SLOTS]);
+	time_t now = std::time(nullptr);
+	for (auto& session : sessions) {
+		//ڼйĻỰµĻԾʱ²룬ر
+		if (!Insert(session, now)) {
+			auto session_ptr = session.lock();
+			if (session_ptr != nullptr) {
+				session_ptr->CloseIdle();
+			}
+		}
+	}
+}
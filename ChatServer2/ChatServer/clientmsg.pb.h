@@ -0,0 +1,6196 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: clientmsg.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_clientmsg_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_clientmsg_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3013000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3013000 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_clientmsg_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_clientmsg_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[15]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_clientmsg_2eproto;
+namespace clientmsg {
+class AddFriendApplyReq;
+class AddFriendApplyReqDefaultTypeInternal;
+extern AddFriendApplyReqDefaultTypeInternal _AddFriendApplyReq_default_instance_;
+class AddFriendApplyRsp;
+class AddFriendApplyRspDefaultTypeInternal;
+extern AddFriendApplyRspDefaultTypeInternal _AddFriendApplyRsp_default_instance_;
+class AuthFriendApplyReq;
+class AuthFriendApplyReqDefaultTypeInternal;
+extern AuthFriendApplyReqDefaultTypeInternal _AuthFriendApplyReq_default_instance_;
+class AuthFriendApplyRsp;
+class AuthFriendApplyRspDefaultTypeInternal;
+extern AuthFriendApplyRspDefaultTypeInternal _AuthFriendApplyRsp_default_instance_;
+class ChatLoginReq;
+class ChatLoginReqDefaultTypeInternal;
+extern ChatLoginReqDefaultTypeInternal _ChatLoginReq_default_instance_;
+class ChatLoginRsp;
+class ChatLoginRspDefaultTypeInternal;
+extern ChatLoginRspDefaultTypeInternal _ChatLoginRsp_default_instance_;
+class HeartBeatRsp;
+class HeartBeatRspDefaultTypeInternal;
+extern HeartBeatRspDefaultTypeInternal _HeartBeatRsp_default_instance_;
+class NotifyAddFriendReq;
+class NotifyAddFriendReqDefaultTypeInternal;
+extern NotifyAddFriendReqDefaultTypeInternal _NotifyAddFriendReq_default_instance_;
+class NotifyAuthFriendReq;
+class NotifyAuthFriendReqDefaultTypeInternal;
+extern NotifyAuthFriendReqDefaultTypeInternal _NotifyAuthFriendReq_default_instance_;
+class SearchUserReq;
+class SearchUserReqDefaultTypeInternal;
+extern SearchUserReqDefaultTypeInternal _SearchUserReq_default_instance_;
+class SearchUserRsp;
+class SearchUserRspDefaultTypeInternal;
+extern SearchUserRspDefaultTypeInternal _SearchUserRsp_default_instance_;
+class TextChatItem;
+class TextChatItemDefaultTypeInternal;
+extern TextChatItemDefaultTypeInternal _TextChatItem_default_instance_;
+class TextChatReq;
+class TextChatReqDefaultTypeInternal;
+extern TextChatReqDefaultTypeInternal _TextChatReq_default_instance_;
+class TextChatRsp;
+class TextChatRspDefaultTypeInternal;
+extern TextChatRspDefaultTypeInternal _TextChatRsp_default_instance_;
+class UserBrief;
+class UserBriefDefaultTypeInternal;
+extern UserBriefDefaultTypeInternal _UserBrief_default_instance_;
+}  // namespace clientmsg
+PROTOBUF_NAMESPACE_OPEN
+template<> ::clientmsg::AddFriendApplyReq* Arena::CreateMaybeMessage<::clientmsg::AddFriendApplyReq>(Arena*);
+template<> ::clientmsg::AddFriendApplyRsp* Arena::CreateMaybeMessage<::clientmsg::AddFriendApplyRsp>(Arena*);
+template<> ::clientmsg::AuthFriendApplyReq* Arena::CreateMaybeMessage<::clientmsg::AuthFriendApplyReq>(Arena*);
+template<> ::clientmsg::AuthFriendApplyRsp* Arena::CreateMaybeMessage<::clientmsg::AuthFriendApplyRsp>(Arena*);
+template<> ::clientmsg::ChatLoginReq* Arena::CreateMaybeMessage<::clientmsg::ChatLoginReq>(Arena*);
+template<> ::clientmsg::ChatLoginRsp* Arena::CreateMaybeMessage<::clientmsg::ChatLoginRsp>(Arena*);
+template<> ::clientmsg::HeartBeatRsp* Arena::CreateMaybeMessage<::clientmsg::HeartBeatRsp>(Arena*);
+template<> ::clientmsg::NotifyAddFriendReq* Arena::CreateMaybeMessage<::clientmsg::NotifyAddFriendReq>(Arena*);
+template<> ::clientmsg::NotifyAuthFriendReq* Arena::CreateMaybeMessage<::clientmsg::NotifyAuthFriendReq>(Arena*);
+template<> ::clientmsg::SearchUserReq* Arena::CreateMaybeMessage<::clientmsg::SearchUserReq>(Arena*);
+template<> ::clientmsg::SearchUserRsp* Arena::CreateMaybeMessage<::clientmsg::SearchUserRsp>(Arena*);
+template<> ::clientmsg::TextChatItem* Arena::CreateMaybeMessage<::clientmsg::TextChatItem>(Arena*);
+template<> ::clientmsg::TextChatReq* Arena::CreateMaybeMessage<::clientmsg::TextChatReq>(Arena*);
+template<> ::clientmsg::TextChatRsp* Arena::CreateMaybeMessage<::clientmsg::TextChatRsp>(Arena*);
+template<> ::clientmsg::UserBrief* Arena::CreateMaybeMessage<::clientmsg::UserBrief>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace clientmsg {
+
+// ===================================================================
+
+class UserBrief PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.UserBrief) */ {
+ public:
+  inline UserBrief() : UserBrief(nullptr) {}
+  virtual ~UserBrief();
+
+  UserBrief(const UserBrief& from);
+  UserBrief(UserBrief&& from) noexcept
+    : UserBrief() {
+    *this = ::std::move(from);
+  }
+
+  inline UserBrief& operator=(const UserBrief& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UserBrief& operator=(UserBrief&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const UserBrief& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const UserBrief* internal_default_instance() {
+    return reinterpret_cast<const UserBrief*>(
+               &_UserBrief_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(UserBrief& a, UserBrief& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UserBrief* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserBrief* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline UserBrief* New() const final {
+    return CreateMaybeMessage<UserBrief>(nullptr);
+  }
+
+  UserBrief* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<UserBrief>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const UserBrief& from);
+  void MergeFrom(const UserBrief& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UserBrief* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.UserBrief";
+  }
+  protected:
+  explicit UserBrief(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 2,
+    kIconFieldNumber = 3,
+    kNickFieldNumber = 4,
+    kDescFieldNumber = 6,
+    kBackFieldNumber = 7,
+    kUidFieldNumber = 1,
+    kSexFieldNumber = 5,
+    kStatusFieldNumber = 8,
+  };
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string icon = 3;
+  void clear_icon();
+  const std::string& icon() const;
+  void set_icon(const std::string& value);
+  void set_icon(std::string&& value);
+  void set_icon(const char* value);
+  void set_icon(const char* value, size_t size);
+  std::string* mutable_icon();
+  std::string* release_icon();
+  void set_allocated_icon(std::string* icon);
+  private:
+  const std::string& _internal_icon() const;
+  void _internal_set_icon(const std::string& value);
+  std::string* _internal_mutable_icon();
+  public:
+
+  // string nick = 4;
+  void clear_nick();
+  const std::string& nick() const;
+  void set_nick(const std::string& value);
+  void set_nick(std::string&& value);
+  void set_nick(const char* value);
+  void set_nick(const char* value, size_t size);
+  std::string* mutable_nick();
+  std::string* release_nick();
+  void set_allocated_nick(std::string* nick);
+  private:
+  const std::string& _internal_nick() const;
+  void _internal_set_nick(const std::string& value);
+  std::string* _internal_mutable_nick();
+  public:
+
+  // string desc = 6;
+  void clear_desc();
+  const std::string& desc() const;
+  void set_desc(const std::string& value);
+  void set_desc(std::string&& value);
+  void set_desc(const char* value);
+  void set_desc(const char* value, size_t size);
+  std::string* mutable_desc();
+  std::string* release_desc();
+  void set_allocated_desc(std::string* desc);
+  private:
+  const std::string& _internal_desc() const;
+  void _internal_set_desc(const std::string& value);
+  std::string* _internal_mutable_desc();
+  public:
+
+  // string back = 7;
+  void clear_back();
+  const std::string& back() const;
+  void set_back(const std::string& value);
+  void set_back(std::string&& value);
+  void set_back(const char* value);
+  void set_back(const char* value, size_t size);
+  std::string* mutable_back();
+  std::string* release_back();
+  void set_allocated_back(std::string* back);
+  private:
+  const std::string& _internal_back() const;
+  void _internal_set_back(const std::string& value);
+  std::string* _internal_mutable_back();
+  public:
+
+  // int32 uid = 1;
+  void clear_uid();
+  ::PROTOBUF_NAMESPACE_ID::int32 uid() const;
+  void set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uid() const;
+  void _internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 sex = 5;
+  void clear_sex();
+  ::PROTOBUF_NAMESPACE_ID::int32 sex() const;
+  void set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sex() const;
+  void _internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 status = 8;
+  void clear_status();
+  ::PROTOBUF_NAMESPACE_ID::int32 status() const;
+  void set_status(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_status() const;
+  void _internal_set_status(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.UserBrief)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr icon_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nick_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr desc_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr back_;
+  ::PROTOBUF_NAMESPACE_ID::int32 uid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sex_;
+  ::PROTOBUF_NAMESPACE_ID::int32 status_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChatLoginReq PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.ChatLoginReq) */ {
+ public:
+  inline ChatLoginReq() : ChatLoginReq(nullptr) {}
+  virtual ~ChatLoginReq();
+
+  ChatLoginReq(const ChatLoginReq& from);
+  ChatLoginReq(ChatLoginReq&& from) noexcept
+    : ChatLoginReq() {
+    *this = ::std::move(from);
+  }
+
+  inline ChatLoginReq& operator=(const ChatLoginReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChatLoginReq& operator=(ChatLoginReq&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const ChatLoginReq& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ChatLoginReq* internal_default_instance() {
+    return reinterpret_cast<const ChatLoginReq*>(
+               &_ChatLoginReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ChatLoginReq& a, ChatLoginReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChatLoginReq* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChatLoginReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ChatLoginReq* New() const final {
+    return CreateMaybeMessage<ChatLoginReq>(nullptr);
+  }
+
+  ChatLoginReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ChatLoginReq>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const ChatLoginReq& from);
+  void MergeFrom(const ChatLoginReq& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChatLoginReq* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.ChatLoginReq";
+  }
+  protected:
+  explicit ChatLoginReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTokenFieldNumber = 2,
+    kCodecFieldNumber = 3,
+    kUidFieldNumber = 1,
+  };
+  // string token = 2;
+  void clear_token();
+  const std::string& token() const;
+  void set_token(const std::string& value);
+  void set_token(std::string&& value);
+  void set_token(const char* value);
+  void set_token(const char* value, size_t size);
+  std::string* mutable_token();
+  std::string* release_token();
+  void set_allocated_token(std::string* token);
+  private:
+  const std::string& _internal_token() const;
+  void _internal_set_token(const std::string& value);
+  std::string* _internal_mutable_token();
+  public:
+
+  // string codec = 3;
+  void clear_codec();
+  const std::string& codec() const;
+  void set_codec(const std::string& value);
+  void set_codec(std::string&& value);
+  void set_codec(const char* value);
+  void set_codec(const char* value, size_t size);
+  std::string* mutable_codec();
+  std::string* release_codec();
+  void set_allocated_codec(std::string* codec);
+  private:
+  const std::string& _internal_codec() const;
+  void _internal_set_codec(const std::string& value);
+  std::string* _internal_mutable_codec();
+  public:
+
+  // int32 uid = 1;
+  void clear_uid();
+  ::PROTOBUF_NAMESPACE_ID::int32 uid() const;
+  void set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uid() const;
+  void _internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.ChatLoginReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr codec_;
+  ::PROTOBUF_NAMESPACE_ID::int32 uid_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChatLoginRsp PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.ChatLoginRsp) */ {
+ public:
+  inline ChatLoginRsp() : ChatLoginRsp(nullptr) {}
+  virtual ~ChatLoginRsp();
+
+  ChatLoginRsp(const ChatLoginRsp& from);
+  ChatLoginRsp(ChatLoginRsp&& from) noexcept
+    : ChatLoginRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline ChatLoginRsp& operator=(const ChatLoginRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChatLoginRsp& operator=(ChatLoginRsp&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const ChatLoginRsp& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ChatLoginRsp* internal_default_instance() {
+    return reinterpret_cast<const ChatLoginRsp*>(
+               &_ChatLoginRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ChatLoginRsp& a, ChatLoginRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChatLoginRsp* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChatLoginRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ChatLoginRsp* New() const final {
+    return CreateMaybeMessage<ChatLoginRsp>(nullptr);
+  }
+
+  ChatLoginRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ChatLoginRsp>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const ChatLoginRsp& from);
+  void MergeFrom(const ChatLoginRsp& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChatLoginRsp* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.ChatLoginRsp";
+  }
+  protected:
+  explicit ChatLoginRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kApplyListFieldNumber = 10,
+    kFriendListFieldNumber = 11,
+    kPwdFieldNumber = 3,
+    kNameFieldNumber = 4,
+    kEmailFieldNumber = 5,
+    kNickFieldNumber = 6,
+    kDescFieldNumber = 7,
+    kIconFieldNumber = 9,
+    kCodecFieldNumber = 12,
+    kErrorFieldNumber = 1,
+    kUidFieldNumber = 2,
+    kSexFieldNumber = 8,
+  };
+  // repeated .clientmsg.UserBrief apply_list = 10;
+  int apply_list_size() const;
+  private:
+  int _internal_apply_list_size() const;
+  public:
+  void clear_apply_list();
+  ::clientmsg::UserBrief* mutable_apply_list(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief >*
+      mutable_apply_list();
+  private:
+  const ::clientmsg::UserBrief& _internal_apply_list(int index) const;
+  ::clientmsg::UserBrief* _internal_add_apply_list();
+  public:
+  const ::clientmsg::UserBrief& apply_list(int index) const;
+  ::clientmsg::UserBrief* add_apply_list();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief >&
+      apply_list() const;
+
+  // repeated .clientmsg.UserBrief friend_list = 11;
+  int friend_list_size() const;
+  private:
+  int _internal_friend_list_size() const;
+  public:
+  void clear_friend_list();
+  ::clientmsg::UserBrief* mutable_friend_list(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief >*
+      mutable_friend_list();
+  private:
+  const ::clientmsg::UserBrief& _internal_friend_list(int index) const;
+  ::clientmsg::UserBrief* _internal_add_friend_list();
+  public:
+  const ::clientmsg::UserBrief& friend_list(int index) const;
+  ::clientmsg::UserBrief* add_friend_list();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief >&
+      friend_list() const;
+
+  // string pwd = 3;
+  void clear_pwd();
+  const std::string& pwd() const;
+  void set_pwd(const std::string& value);
+  void set_pwd(std::string&& value);
+  void set_pwd(const char* value);
+  void set_pwd(const char* value, size_t size);
+  std::string* mutable_pwd();
+  std::string* release_pwd();
+  void set_allocated_pwd(std::string* pwd);
+  private:
+  const std::string& _internal_pwd() const;
+  void _internal_set_pwd(const std::string& value);
+  std::string* _internal_mutable_pwd();
+  public:
+
+  // string name = 4;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string email = 5;
+  void clear_email();
+  const std::string& email() const;
+  void set_email(const std::string& value);
+  void set_email(std::string&& value);
+  void set_email(const char* value);
+  void set_email(const char* value, size_t size);
+  std::string* mutable_email();
+  std::string* release_email();
+  void set_allocated_email(std::string* email);
+  private:
+  const std::string& _internal_email() const;
+  void _internal_set_email(const std::string& value);
+  std::string* _internal_mutable_email();
+  public:
+
+  // string nick = 6;
+  void clear_nick();
+  const std::string& nick() const;
+  void set_nick(const std::string& value);
+  void set_nick(std::string&& value);
+  void set_nick(const char* value);
+  void set_nick(const char* value, size_t size);
+  std::string* mutable_nick();
+  std::string* release_nick();
+  void set_allocated_nick(std::string* nick);
+  private:
+  const std::string& _internal_nick() const;
+  void _internal_set_nick(const std::string& value);
+  std::string* _internal_mutable_nick();
+  public:
+
+  // string desc = 7;
+  void clear_desc();
+  const std::string& desc() const;
+  void set_desc(const std::string& value);
+  void set_desc(std::string&& value);
+  void set_desc(const char* value);
+  void set_desc(const char* value, size_t size);
+  std::string* mutable_desc();
+  std::string* release_desc();
+  void set_allocated_desc(std::string* desc);
+  private:
+  const std::string& _internal_desc() const;
+  void _internal_set_desc(const std::string& value);
+  std::string* _internal_mutable_desc();
+  public:
+
+  // string icon = 9;
+  void clear_icon();
+  const std::string& icon() const;
+  void set_icon(const std::string& value);
+  void set_icon(std::string&& value);
+  void set_icon(const char* value);
+  void set_icon(const char* value, size_t size);
+  std::string* mutable_icon();
+  std::string* release_icon();
+  void set_allocated_icon(std::string* icon);
+  private:
+  const std::string& _internal_icon() const;
+  void _internal_set_icon(const std::string& value);
+  std::string* _internal_mutable_icon();
+  public:
+
+  // string codec = 12;
+  void clear_codec();
+  const std::string& codec() const;
+  void set_codec(const std::string& value);
+  void set_codec(std::string&& value);
+  void set_codec(const char* value);
+  void set_codec(const char* value, size_t size);
+  std::string* mutable_codec();
+  std::string* release_codec();
+  void set_allocated_codec(std::string* codec);
+  private:
+  const std::string& _internal_codec() const;
+  void _internal_set_codec(const std::string& value);
+  std::string* _internal_mutable_codec();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 uid = 2;
+  void clear_uid();
+  ::PROTOBUF_NAMESPACE_ID::int32 uid() const;
+  void set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uid() const;
+  void _internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 sex = 8;
+  void clear_sex();
+  ::PROTOBUF_NAMESPACE_ID::int32 sex() const;
+  void set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sex() const;
+  void _internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.ChatLoginRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief > apply_list_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief > friend_list_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nick_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr desc_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr icon_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr codec_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  ::PROTOBUF_NAMESPACE_ID::int32 uid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sex_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchUserReq PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.SearchUserReq) */ {
+ public:
+  inline SearchUserReq() : SearchUserReq(nullptr) {}
+  virtual ~SearchUserReq();
+
+  SearchUserReq(const SearchUserReq& from);
+  SearchUserReq(SearchUserReq&& from) noexcept
+    : SearchUserReq() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchUserReq& operator=(const SearchUserReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchUserReq& operator=(SearchUserReq&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SearchUserReq& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SearchUserReq* internal_default_instance() {
+    return reinterpret_cast<const SearchUserReq*>(
+               &_SearchUserReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SearchUserReq& a, SearchUserReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchUserReq* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchUserReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SearchUserReq* New() const final {
+    return CreateMaybeMessage<SearchUserReq>(nullptr);
+  }
+
+  SearchUserReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SearchUserReq>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SearchUserReq& from);
+  void MergeFrom(const SearchUserReq& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchUserReq* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.SearchUserReq";
+  }
+  protected:
+  explicit SearchUserReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUidFieldNumber = 1,
+  };
+  // string uid = 1;
+  void clear_uid();
+  const std::string& uid() const;
+  void set_uid(const std::string& value);
+  void set_uid(std::string&& value);
+  void set_uid(const char* value);
+  void set_uid(const char* value, size_t size);
+  std::string* mutable_uid();
+  std::string* release_uid();
+  void set_allocated_uid(std::string* uid);
+  private:
+  const std::string& _internal_uid() const;
+  void _internal_set_uid(const std::string& value);
+  std::string* _internal_mutable_uid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.SearchUserReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uid_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchUserRsp PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.SearchUserRsp) */ {
+ public:
+  inline SearchUserRsp() : SearchUserRsp(nullptr) {}
+  virtual ~SearchUserRsp();
+
+  SearchUserRsp(const SearchUserRsp& from);
+  SearchUserRsp(SearchUserRsp&& from) noexcept
+    : SearchUserRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchUserRsp& operator=(const SearchUserRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchUserRsp& operator=(SearchUserRsp&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SearchUserRsp& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SearchUserRsp* internal_default_instance() {
+    return reinterpret_cast<const SearchUserRsp*>(
+               &_SearchUserRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(SearchUserRsp& a, SearchUserRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchUserRsp* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchUserRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SearchUserRsp* New() const final {
+    return CreateMaybeMessage<SearchUserRsp>(nullptr);
+  }
+
+  SearchUserRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SearchUserRsp>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SearchUserRsp& from);
+  void MergeFrom(const SearchUserRsp& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchUserRsp* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.SearchUserRsp";
+  }
+  protected:
+  explicit SearchUserRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPwdFieldNumber = 3,
+    kNameFieldNumber = 4,
+    kEmailFieldNumber = 5,
+    kNickFieldNumber = 6,
+    kDescFieldNumber = 7,
+    kIconFieldNumber = 9,
+    kErrorFieldNumber = 1,
+    kUidFieldNumber = 2,
+    kSexFieldNumber = 8,
+  };
+  // string pwd = 3;
+  void clear_pwd();
+  const std::string& pwd() const;
+  void set_pwd(const std::string& value);
+  void set_pwd(std::string&& value);
+  void set_pwd(const char* value);
+  void set_pwd(const char* value, size_t size);
+  std::string* mutable_pwd();
+  std::string* release_pwd();
+  void set_allocated_pwd(std::string* pwd);
+  private:
+  const std::string& _internal_pwd() const;
+  void _internal_set_pwd(const std::string& value);
+  std::string* _internal_mutable_pwd();
+  public:
+
+  // string name = 4;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string email = 5;
+  void clear_email();
+  const std::string& email() const;
+  void set_email(const std::string& value);
+  void set_email(std::string&& value);
+  void set_email(const char* value);
+  void set_email(const char* value, size_t size);
+  std::string* mutable_email();
+  std::string* release_email();
+  void set_allocated_email(std::string* email);
+  private:
+  const std::string& _internal_email() const;
+  void _internal_set_email(const std::string& value);
+  std::string* _internal_mutable_email();
+  public:
+
+  // string nick = 6;
+  void clear_nick();
+  const std::string& nick() const;
+  void set_nick(const std::string& value);
+  void set_nick(std::string&& value);
+  void set_nick(const char* value);
+  void set_nick(const char* value, size_t size);
+  std::string* mutable_nick();
+  std::string* release_nick();
+  void set_allocated_nick(std::string* nick);
+  private:
+  const std::string& _internal_nick() const;
+  void _internal_set_nick(const std::string& value);
+  std::string* _internal_mutable_nick();
+  public:
+
+  // string desc = 7;
+  void clear_desc();
+  const std::string& desc() const;
+  void set_desc(const std::string& value);
+  void set_desc(std::string&& value);
+  void set_desc(const char* value);
+  void set_desc(const char* value, size_t size);
+  std::string* mutable_desc();
+  std::string* release_desc();
+  void set_allocated_desc(std::string* desc);
+  private:
+  const std::string& _internal_desc() const;
+  void _internal_set_desc(const std::string& value);
+  std::string* _internal_mutable_desc();
+  public:
+
+  // string icon = 9;
+  void clear_icon();
+  const std::string& icon() const;
+  void set_icon(const std::string& value);
+  void set_icon(std::string&& value);
+  void set_icon(const char* value);
+  void set_icon(const char* value, size_t size);
+  std::string* mutable_icon();
+  std::string* release_icon();
+  void set_allocated_icon(std::string* icon);
+  private:
+  const std::string& _internal_icon() const;
+  void _internal_set_icon(const std::string& value);
+  std::string* _internal_mutable_icon();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 uid = 2;
+  void clear_uid();
+  ::PROTOBUF_NAMESPACE_ID::int32 uid() const;
+  void set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uid() const;
+  void _internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 sex = 8;
+  void clear_sex();
+  ::PROTOBUF_NAMESPACE_ID::int32 sex() const;
+  void set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sex() const;
+  void _internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.SearchUserRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nick_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr desc_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr icon_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  ::PROTOBUF_NAMESPACE_ID::int32 uid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sex_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AddFriendApplyReq PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.AddFriendApplyReq) */ {
+ public:
+  inline AddFriendApplyReq() : AddFriendApplyReq(nullptr) {}
+  virtual ~AddFriendApplyReq();
+
+  AddFriendApplyReq(const AddFriendApplyReq& from);
+  AddFriendApplyReq(AddFriendApplyReq&& from) noexcept
+    : AddFriendApplyReq() {
+    *this = ::std::move(from);
+  }
+
+  inline AddFriendApplyReq& operator=(const AddFriendApplyReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AddFriendApplyReq& operator=(AddFriendApplyReq&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AddFriendApplyReq& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AddFriendApplyReq* internal_default_instance() {
+    return reinterpret_cast<const AddFriendApplyReq*>(
+               &_AddFriendApplyReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(AddFriendApplyReq& a, AddFriendApplyReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AddFriendApplyReq* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AddFriendApplyReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AddFriendApplyReq* New() const final {
+    return CreateMaybeMessage<AddFriendApplyReq>(nullptr);
+  }
+
+  AddFriendApplyReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AddFriendApplyReq>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AddFriendApplyReq& from);
+  void MergeFrom(const AddFriendApplyReq& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AddFriendApplyReq* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.AddFriendApplyReq";
+  }
+  protected:
+  explicit AddFriendApplyReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kApplynameFieldNumber = 2,
+    kBaknameFieldNumber = 3,
+    kUidFieldNumber = 1,
+    kTouidFieldNumber = 4,
+  };
+  // string applyname = 2;
+  void clear_applyname();
+  const std::string& applyname() const;
+  void set_applyname(const std::string& value);
+  void set_applyname(std::string&& value);
+  void set_applyname(const char* value);
+  void set_applyname(const char* value, size_t size);
+  std::string* mutable_applyname();
+  std::string* release_applyname();
+  void set_allocated_applyname(std::string* applyname);
+  private:
+  const std::string& _internal_applyname() const;
+  void _internal_set_applyname(const std::string& value);
+  std::string* _internal_mutable_applyname();
+  public:
+
+  // string bakname = 3;
+  void clear_bakname();
+  const std::string& bakname() const;
+  void set_bakname(const std::string& value);
+  void set_bakname(std::string&& value);
+  void set_bakname(const char* value);
+  void set_bakname(const char* value, size_t size);
+  std::string* mutable_bakname();
+  std::string* release_bakname();
+  void set_allocated_bakname(std::string* bakname);
+  private:
+  const std::string& _internal_bakname() const;
+  void _internal_set_bakname(const std::string& value);
+  std::string* _internal_mutable_bakname();
+  public:
+
+  // int32 uid = 1;
+  void clear_uid();
+  ::PROTOBUF_NAMESPACE_ID::int32 uid() const;
+  void set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uid() const;
+  void _internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 touid = 4;
+  void clear_touid();
+  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
+  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
+  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.AddFriendApplyReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr applyname_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bakname_;
+  ::PROTOBUF_NAMESPACE_ID::int32 uid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AddFriendApplyRsp PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.AddFriendApplyRsp) */ {
+ public:
+  inline AddFriendApplyRsp() : AddFriendApplyRsp(nullptr) {}
+  virtual ~AddFriendApplyRsp();
+
+  AddFriendApplyRsp(const AddFriendApplyRsp& from);
+  AddFriendApplyRsp(AddFriendApplyRsp&& from) noexcept
+    : AddFriendApplyRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline AddFriendApplyRsp& operator=(const AddFriendApplyRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AddFriendApplyRsp& operator=(AddFriendApplyRsp&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AddFriendApplyRsp& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AddFriendApplyRsp* internal_default_instance() {
+    return reinterpret_cast<const AddFriendApplyRsp*>(
+               &_AddFriendApplyRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(AddFriendApplyRsp& a, AddFriendApplyRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AddFriendApplyRsp* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AddFriendApplyRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AddFriendApplyRsp* New() const final {
+    return CreateMaybeMessage<AddFriendApplyRsp>(nullptr);
+  }
+
+  AddFriendApplyRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AddFriendApplyRsp>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AddFriendApplyRsp& from);
+  void MergeFrom(const AddFriendApplyRsp& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AddFriendApplyRsp* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.AddFriendApplyRsp";
+  }
+  protected:
+  explicit AddFriendApplyRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.AddFriendApplyRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NotifyAddFriendReq PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.NotifyAddFriendReq) */ {
+ public:
+  inline NotifyAddFriendReq() : NotifyAddFriendReq(nullptr) {}
+  virtual ~NotifyAddFriendReq();
+
+  NotifyAddFriendReq(const NotifyAddFriendReq& from);
+  NotifyAddFriendReq(NotifyAddFriendReq&& from) noexcept
+    : NotifyAddFriendReq() {
+    *this = ::std::move(from);
+  }
+
+  inline NotifyAddFriendReq& operator=(const NotifyAddFriendReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NotifyAddFriendReq& operator=(NotifyAddFriendReq&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const NotifyAddFriendReq& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const NotifyAddFriendReq* internal_default_instance() {
+    return reinterpret_cast<const NotifyAddFriendReq*>(
+               &_NotifyAddFriendReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(NotifyAddFriendReq& a, NotifyAddFriendReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NotifyAddFriendReq* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NotifyAddFriendReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline NotifyAddFriendReq* New() const final {
+    return CreateMaybeMessage<NotifyAddFriendReq>(nullptr);
+  }
+
+  NotifyAddFriendReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<NotifyAddFriendReq>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const NotifyAddFriendReq& from);
+  void MergeFrom(const NotifyAddFriendReq& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NotifyAddFriendReq* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.NotifyAddFriendReq";
+  }
+  protected:
+  explicit NotifyAddFriendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 3,
+    kDescFieldNumber = 4,
+    kIconFieldNumber = 5,
+    kNickFieldNumber = 7,
+    kErrorFieldNumber = 1,
+    kApplyuidFieldNumber = 2,
+    kSexFieldNumber = 6,
+  };
+  // string name = 3;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string desc = 4;
+  void clear_desc();
+  const std::string& desc() const;
+  void set_desc(const std::string& value);
+  void set_desc(std::string&& value);
+  void set_desc(const char* value);
+  void set_desc(const char* value, size_t size);
+  std::string* mutable_desc();
+  std::string* release_desc();
+  void set_allocated_desc(std::string* desc);
+  private:
+  const std::string& _internal_desc() const;
+  void _internal_set_desc(const std::string& value);
+  std::string* _internal_mutable_desc();
+  public:
+
+  // string icon = 5;
+  void clear_icon();
+  const std::string& icon() const;
+  void set_icon(const std::string& value);
+  void set_icon(std::string&& value);
+  void set_icon(const char* value);
+  void set_icon(const char* value, size_t size);
+  std::string* mutable_icon();
+  std::string* release_icon();
+  void set_allocated_icon(std::string* icon);
+  private:
+  const std::string& _internal_icon() const;
+  void _internal_set_icon(const std::string& value);
+  std::string* _internal_mutable_icon();
+  public:
+
+  // string nick = 7;
+  void clear_nick();
+  const std::string& nick() const;
+  void set_nick(const std::string& value);
+  void set_nick(std::string&& value);
+  void set_nick(const char* value);
+  void set_nick(const char* value, size_t size);
+  std::string* mutable_nick();
+  std::string* release_nick();
+  void set_allocated_nick(std::string* nick);
+  private:
+  const std::string& _internal_nick() const;
+  void _internal_set_nick(const std::string& value);
+  std::string* _internal_mutable_nick();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 applyuid = 2;
+  void clear_applyuid();
+  ::PROTOBUF_NAMESPACE_ID::int32 applyuid() const;
+  void set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_applyuid() const;
+  void _internal_set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 sex = 6;
+  void clear_sex();
+  ::PROTOBUF_NAMESPACE_ID::int32 sex() const;
+  void set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sex() const;
+  void _internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.NotifyAddFriendReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr desc_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr icon_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nick_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  ::PROTOBUF_NAMESPACE_ID::int32 applyuid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sex_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AuthFriendApplyReq PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.AuthFriendApplyReq) */ {
+ public:
+  inline AuthFriendApplyReq() : AuthFriendApplyReq(nullptr) {}
+  virtual ~AuthFriendApplyReq();
+
+  AuthFriendApplyReq(const AuthFriendApplyReq& from);
+  AuthFriendApplyReq(AuthFriendApplyReq&& from) noexcept
+    : AuthFriendApplyReq() {
+    *this = ::std::move(from);
+  }
+
+  inline AuthFriendApplyReq& operator=(const AuthFriendApplyReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AuthFriendApplyReq& operator=(AuthFriendApplyReq&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AuthFriendApplyReq& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AuthFriendApplyReq* internal_default_instance() {
+    return reinterpret_cast<const AuthFriendApplyReq*>(
+               &_AuthFriendApplyReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(AuthFriendApplyReq& a, AuthFriendApplyReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AuthFriendApplyReq* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AuthFriendApplyReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AuthFriendApplyReq* New() const final {
+    return CreateMaybeMessage<AuthFriendApplyReq>(nullptr);
+  }
+
+  AuthFriendApplyReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AuthFriendApplyReq>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AuthFriendApplyReq& from);
+  void MergeFrom(const AuthFriendApplyReq& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AuthFriendApplyReq* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.AuthFriendApplyReq";
+  }
+  protected:
+  explicit AuthFriendApplyReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBackFieldNumber = 3,
+    kFromuidFieldNumber = 1,
+    kTouidFieldNumber = 2,
+  };
+  // string back = 3;
+  void clear_back();
+  const std::string& back() const;
+  void set_back(const std::string& value);
+  void set_back(std::string&& value);
+  void set_back(const char* value);
+  void set_back(const char* value, size_t size);
+  std::string* mutable_back();
+  std::string* release_back();
+  void set_allocated_back(std::string* back);
+  private:
+  const std::string& _internal_back() const;
+  void _internal_set_back(const std::string& value);
+  std::string* _internal_mutable_back();
+  public:
+
+  // int32 fromuid = 1;
+  void clear_fromuid();
+  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
+  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
+  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 touid = 2;
+  void clear_touid();
+  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
+  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
+  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.AuthFriendApplyReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr back_;
+  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AuthFriendApplyRsp PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.AuthFriendApplyRsp) */ {
+ public:
+  inline AuthFriendApplyRsp() : AuthFriendApplyRsp(nullptr) {}
+  virtual ~AuthFriendApplyRsp();
+
+  AuthFriendApplyRsp(const AuthFriendApplyRsp& from);
+  AuthFriendApplyRsp(AuthFriendApplyRsp&& from) noexcept
+    : AuthFriendApplyRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline AuthFriendApplyRsp& operator=(const AuthFriendApplyRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AuthFriendApplyRsp& operator=(AuthFriendApplyRsp&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AuthFriendApplyRsp& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AuthFriendApplyRsp* internal_default_instance() {
+    return reinterpret_cast<const AuthFriendApplyRsp*>(
+               &_AuthFriendApplyRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(AuthFriendApplyRsp& a, AuthFriendApplyRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AuthFriendApplyRsp* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AuthFriendApplyRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AuthFriendApplyRsp* New() const final {
+    return CreateMaybeMessage<AuthFriendApplyRsp>(nullptr);
+  }
+
+  AuthFriendApplyRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AuthFriendApplyRsp>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AuthFriendApplyRsp& from);
+  void MergeFrom(const AuthFriendApplyRsp& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AuthFriendApplyRsp* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.AuthFriendApplyRsp";
+  }
+  protected:
+  explicit AuthFriendApplyRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 3,
+    kNickFieldNumber = 4,
+    kIconFieldNumber = 5,
+    kErrorFieldNumber = 1,
+    kUidFieldNumber = 2,
+    kSexFieldNumber = 6,
+  };
+  // string name = 3;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string nick = 4;
+  void clear_nick();
+  const std::string& nick() const;
+  void set_nick(const std::string& value);
+  void set_nick(std::string&& value);
+  void set_nick(const char* value);
+  void set_nick(const char* value, size_t size);
+  std::string* mutable_nick();
+  std::string* release_nick();
+  void set_allocated_nick(std::string* nick);
+  private:
+  const std::string& _internal_nick() const;
+  void _internal_set_nick(const std::string& value);
+  std::string* _internal_mutable_nick();
+  public:
+
+  // string icon = 5;
+  void clear_icon();
+  const std::string& icon() const;
+  void set_icon(const std::string& value);
+  void set_icon(std::string&& value);
+  void set_icon(const char* value);
+  void set_icon(const char* value, size_t size);
+  std::string* mutable_icon();
+  std::string* release_icon();
+  void set_allocated_icon(std::string* icon);
+  private:
+  const std::string& _internal_icon() const;
+  void _internal_set_icon(const std::string& value);
+  std::string* _internal_mutable_icon();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 uid = 2;
+  void clear_uid();
+  ::PROTOBUF_NAMESPACE_ID::int32 uid() const;
+  void set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uid() const;
+  void _internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 sex = 6;
+  void clear_sex();
+  ::PROTOBUF_NAMESPACE_ID::int32 sex() const;
+  void set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sex() const;
+  void _internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.AuthFriendApplyRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nick_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr icon_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  ::PROTOBUF_NAMESPACE_ID::int32 uid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sex_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NotifyAuthFriendReq PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.NotifyAuthFriendReq) */ {
+ public:
+  inline NotifyAuthFriendReq() : NotifyAuthFriendReq(nullptr) {}
+  virtual ~NotifyAuthFriendReq();
+
+  NotifyAuthFriendReq(const NotifyAuthFriendReq& from);
+  NotifyAuthFriendReq(NotifyAuthFriendReq&& from) noexcept
+    : NotifyAuthFriendReq() {
+    *this = ::std::move(from);
+  }
+
+  inline NotifyAuthFriendReq& operator=(const NotifyAuthFriendReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NotifyAuthFriendReq& operator=(NotifyAuthFriendReq&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const NotifyAuthFriendReq& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const NotifyAuthFriendReq* internal_default_instance() {
+    return reinterpret_cast<const NotifyAuthFriendReq*>(
+               &_NotifyAuthFriendReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(NotifyAuthFriendReq& a, NotifyAuthFriendReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NotifyAuthFriendReq* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NotifyAuthFriendReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline NotifyAuthFriendReq* New() const final {
+    return CreateMaybeMessage<NotifyAuthFriendReq>(nullptr);
+  }
+
+  NotifyAuthFriendReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<NotifyAuthFriendReq>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const NotifyAuthFriendReq& from);
+  void MergeFrom(const NotifyAuthFriendReq& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NotifyAuthFriendReq* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.NotifyAuthFriendReq";
+  }
+  protected:
+  explicit NotifyAuthFriendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 4,
+    kNickFieldNumber = 5,
+    kIconFieldNumber = 6,
+    kErrorFieldNumber = 1,
+    kFromuidFieldNumber = 2,
+    kTouidFieldNumber = 3,
+    kSexFieldNumber = 7,
+  };
+  // string name = 4;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string nick = 5;
+  void clear_nick();
+  const std::string& nick() const;
+  void set_nick(const std::string& value);
+  void set_nick(std::string&& value);
+  void set_nick(const char* value);
+  void set_nick(const char* value, size_t size);
+  std::string* mutable_nick();
+  std::string* release_nick();
+  void set_allocated_nick(std::string* nick);
+  private:
+  const std::string& _internal_nick() const;
+  void _internal_set_nick(const std::string& value);
+  std::string* _internal_mutable_nick();
+  public:
+
+  // string icon = 6;
+  void clear_icon();
+  const std::string& icon() const;
+  void set_icon(const std::string& value);
+  void set_icon(std::string&& value);
+  void set_icon(const char* value);
+  void set_icon(const char* value, size_t size);
+  std::string* mutable_icon();
+  std::string* release_icon();
+  void set_allocated_icon(std::string* icon);
+  private:
+  const std::string& _internal_icon() const;
+  void _internal_set_icon(const std::string& value);
+  std::string* _internal_mutable_icon();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 fromuid = 2;
+  void clear_fromuid();
+  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
+  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
+  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 touid = 3;
+  void clear_touid();
+  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
+  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
+  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 sex = 7;
+  void clear_sex();
+  ::PROTOBUF_NAMESPACE_ID::int32 sex() const;
+  void set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sex() const;
+  void _internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.NotifyAuthFriendReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nick_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr icon_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sex_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TextChatItem PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.TextChatItem) */ {
+ public:
+  inline TextChatItem() : TextChatItem(nullptr) {}
+  virtual ~TextChatItem();
+
+  TextChatItem(const TextChatItem& from);
+  TextChatItem(TextChatItem&& from) noexcept
+    : TextChatItem() {
+    *this = ::std::move(from);
+  }
+
+  inline TextChatItem& operator=(const TextChatItem& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TextChatItem& operator=(TextChatItem&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TextChatItem& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TextChatItem* internal_default_instance() {
+    return reinterpret_cast<const TextChatItem*>(
+               &_TextChatItem_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(TextChatItem& a, TextChatItem& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TextChatItem* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TextChatItem* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TextChatItem* New() const final {
+    return CreateMaybeMessage<TextChatItem>(nullptr);
+  }
+
+  TextChatItem* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TextChatItem>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TextChatItem& from);
+  void MergeFrom(const TextChatItem& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TextChatItem* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.TextChatItem";
+  }
+  protected:
+  explicit TextChatItem(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgidFieldNumber = 1,
+    kContentFieldNumber = 2,
+  };
+  // string msgid = 1;
+  void clear_msgid();
+  const std::string& msgid() const;
+  void set_msgid(const std::string& value);
+  void set_msgid(std::string&& value);
+  void set_msgid(const char* value);
+  void set_msgid(const char* value, size_t size);
+  std::string* mutable_msgid();
+  std::string* release_msgid();
+  void set_allocated_msgid(std::string* msgid);
+  private:
+  const std::string& _internal_msgid() const;
+  void _internal_set_msgid(const std::string& value);
+  std::string* _internal_mutable_msgid();
+  public:
+
+  // string content = 2;
+  void clear_content();
+  const std::string& content() const;
+  void set_content(const std::string& value);
+  void set_content(std::string&& value);
+  void set_content(const char* value);
+  void set_content(const char* value, size_t size);
+  std::string* mutable_content();
+  std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.TextChatItem)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msgid_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TextChatReq PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.TextChatReq) */ {
+ public:
+  inline TextChatReq() : TextChatReq(nullptr) {}
+  virtual ~TextChatReq();
+
+  TextChatReq(const TextChatReq& from);
+  TextChatReq(TextChatReq&& from) noexcept
+    : TextChatReq() {
+    *this = ::std::move(from);
+  }
+
+  inline TextChatReq& operator=(const TextChatReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TextChatReq& operator=(TextChatReq&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TextChatReq& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TextChatReq* internal_default_instance() {
+    return reinterpret_cast<const TextChatReq*>(
+               &_TextChatReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(TextChatReq& a, TextChatReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TextChatReq* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TextChatReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TextChatReq* New() const final {
+    return CreateMaybeMessage<TextChatReq>(nullptr);
+  }
+
+  TextChatReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TextChatReq>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TextChatReq& from);
+  void MergeFrom(const TextChatReq& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TextChatReq* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.TextChatReq";
+  }
+  protected:
+  explicit TextChatReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTextArrayFieldNumber = 3,
+    kFromuidFieldNumber = 1,
+    kTouidFieldNumber = 2,
+  };
+  // repeated .clientmsg.TextChatItem text_array = 3;
+  int text_array_size() const;
+  private:
+  int _internal_text_array_size() const;
+  public:
+  void clear_text_array();
+  ::clientmsg::TextChatItem* mutable_text_array(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem >*
+      mutable_text_array();
+  private:
+  const ::clientmsg::TextChatItem& _internal_text_array(int index) const;
+  ::clientmsg::TextChatItem* _internal_add_text_array();
+  public:
+  const ::clientmsg::TextChatItem& text_array(int index) const;
+  ::clientmsg::TextChatItem* add_text_array();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem >&
+      text_array() const;
+
+  // int32 fromuid = 1;
+  void clear_fromuid();
+  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
+  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
+  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 touid = 2;
+  void clear_touid();
+  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
+  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
+  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.TextChatReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem > text_array_;
+  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TextChatRsp PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.TextChatRsp) */ {
+ public:
+  inline TextChatRsp() : TextChatRsp(nullptr) {}
+  virtual ~TextChatRsp();
+
+  TextChatRsp(const TextChatRsp& from);
+  TextChatRsp(TextChatRsp&& from) noexcept
+    : TextChatRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline TextChatRsp& operator=(const TextChatRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TextChatRsp& operator=(TextChatRsp&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TextChatRsp& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TextChatRsp* internal_default_instance() {
+    return reinterpret_cast<const TextChatRsp*>(
+               &_TextChatRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(TextChatRsp& a, TextChatRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TextChatRsp* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TextChatRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TextChatRsp* New() const final {
+    return CreateMaybeMessage<TextChatRsp>(nullptr);
+  }
+
+  TextChatRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TextChatRsp>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TextChatRsp& from);
+  void MergeFrom(const TextChatRsp& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TextChatRsp* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.TextChatRsp";
+  }
+  protected:
+  explicit TextChatRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTextArrayFieldNumber = 4,
+    kErrorFieldNumber = 1,
+    kFromuidFieldNumber = 2,
+    kTouidFieldNumber = 3,
+  };
+  // repeated .clientmsg.TextChatItem text_array = 4;
+  int text_array_size() const;
+  private:
+  int _internal_text_array_size() const;
+  public:
+  void clear_text_array();
+  ::clientmsg::TextChatItem* mutable_text_array(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem >*
+      mutable_text_array();
+  private:
+  const ::clientmsg::TextChatItem& _internal_text_array(int index) const;
+  ::clientmsg::TextChatItem* _internal_add_text_array();
+  public:
+  const ::clientmsg::TextChatItem& text_array(int index) const;
+  ::clientmsg::TextChatItem* add_text_array();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem >&
+      text_array() const;
+
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 fromuid = 2;
+  void clear_fromuid();
+  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
+  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
+  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 touid = 3;
+  void clear_touid();
+  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
+  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
+  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.TextChatRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem > text_array_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
+  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HeartBeatRsp PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:clientmsg.HeartBeatRsp) */ {
+ public:
+  inline HeartBeatRsp() : HeartBeatRsp(nullptr) {}
+  virtual ~HeartBeatRsp();
+
+  HeartBeatRsp(const HeartBeatRsp& from);
+  HeartBeatRsp(HeartBeatRsp&& from) noexcept
+    : HeartBeatRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline HeartBeatRsp& operator=(const HeartBeatRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HeartBeatRsp& operator=(HeartBeatRsp&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const HeartBeatRsp& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const HeartBeatRsp* internal_default_instance() {
+    return reinterpret_cast<const HeartBeatRsp*>(
+               &_HeartBeatRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(HeartBeatRsp& a, HeartBeatRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HeartBeatRsp* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HeartBeatRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline HeartBeatRsp* New() const final {
+    return CreateMaybeMessage<HeartBeatRsp>(nullptr);
+  }
+
+  HeartBeatRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<HeartBeatRsp>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const HeartBeatRsp& from);
+  void MergeFrom(const HeartBeatRsp& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HeartBeatRsp* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "clientmsg.HeartBeatRsp";
+  }
+  protected:
+  explicit HeartBeatRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_clientmsg_2eproto);
+    return ::descriptor_table_clientmsg_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:clientmsg.HeartBeatRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_clientmsg_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// UserBrief
+
+// int32 uid = 1;
+inline void UserBrief::clear_uid() {
+  uid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 UserBrief::_internal_uid() const {
+  return uid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 UserBrief::uid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.UserBrief.uid)
+  return _internal_uid();
+}
+inline void UserBrief::_internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  uid_ = value;
+}
+inline void UserBrief::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.UserBrief.uid)
+}
+
+// string name = 2;
+inline void UserBrief::clear_name() {
+  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& UserBrief::name() const {
+  // @@protoc_insertion_point(field_get:clientmsg.UserBrief.name)
+  return _internal_name();
+}
+inline void UserBrief::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:clientmsg.UserBrief.name)
+}
+inline std::string* UserBrief::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.UserBrief.name)
+  return _internal_mutable_name();
+}
+inline const std::string& UserBrief::_internal_name() const {
+  return name_.Get();
+}
+inline void UserBrief::_internal_set_name(const std::string& value) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void UserBrief::set_name(std::string&& value) {
+  
+  name_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.UserBrief.name)
+}
+inline void UserBrief::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.UserBrief.name)
+}
+inline void UserBrief::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.UserBrief.name)
+}
+inline std::string* UserBrief::_internal_mutable_name() {
+  
+  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* UserBrief::release_name() {
+  // @@protoc_insertion_point(field_release:clientmsg.UserBrief.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void UserBrief::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.UserBrief.name)
+}
+
+// string icon = 3;
+inline void UserBrief::clear_icon() {
+  icon_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& UserBrief::icon() const {
+  // @@protoc_insertion_point(field_get:clientmsg.UserBrief.icon)
+  return _internal_icon();
+}
+inline void UserBrief::set_icon(const std::string& value) {
+  _internal_set_icon(value);
+  // @@protoc_insertion_point(field_set:clientmsg.UserBrief.icon)
+}
+inline std::string* UserBrief::mutable_icon() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.UserBrief.icon)
+  return _internal_mutable_icon();
+}
+inline const std::string& UserBrief::_internal_icon() const {
+  return icon_.Get();
+}
+inline void UserBrief::_internal_set_icon(const std::string& value) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void UserBrief::set_icon(std::string&& value) {
+  
+  icon_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.UserBrief.icon)
+}
+inline void UserBrief::set_icon(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.UserBrief.icon)
+}
+inline void UserBrief::set_icon(const char* value,
+    size_t size) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.UserBrief.icon)
+}
+inline std::string* UserBrief::_internal_mutable_icon() {
+  
+  return icon_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* UserBrief::release_icon() {
+  // @@protoc_insertion_point(field_release:clientmsg.UserBrief.icon)
+  return icon_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void UserBrief::set_allocated_icon(std::string* icon) {
+  if (icon != nullptr) {
+    
+  } else {
+    
+  }
+  icon_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), icon,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.UserBrief.icon)
+}
+
+// string nick = 4;
+inline void UserBrief::clear_nick() {
+  nick_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& UserBrief::nick() const {
+  // @@protoc_insertion_point(field_get:clientmsg.UserBrief.nick)
+  return _internal_nick();
+}
+inline void UserBrief::set_nick(const std::string& value) {
+  _internal_set_nick(value);
+  // @@protoc_insertion_point(field_set:clientmsg.UserBrief.nick)
+}
+inline std::string* UserBrief::mutable_nick() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.UserBrief.nick)
+  return _internal_mutable_nick();
+}
+inline const std::string& UserBrief::_internal_nick() const {
+  return nick_.Get();
+}
+inline void UserBrief::_internal_set_nick(const std::string& value) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void UserBrief::set_nick(std::string&& value) {
+  
+  nick_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.UserBrief.nick)
+}
+inline void UserBrief::set_nick(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.UserBrief.nick)
+}
+inline void UserBrief::set_nick(const char* value,
+    size_t size) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.UserBrief.nick)
+}
+inline std::string* UserBrief::_internal_mutable_nick() {
+  
+  return nick_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* UserBrief::release_nick() {
+  // @@protoc_insertion_point(field_release:clientmsg.UserBrief.nick)
+  return nick_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void UserBrief::set_allocated_nick(std::string* nick) {
+  if (nick != nullptr) {
+    
+  } else {
+    
+  }
+  nick_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nick,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.UserBrief.nick)
+}
+
+// int32 sex = 5;
+inline void UserBrief::clear_sex() {
+  sex_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 UserBrief::_internal_sex() const {
+  return sex_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 UserBrief::sex() const {
+  // @@protoc_insertion_point(field_get:clientmsg.UserBrief.sex)
+  return _internal_sex();
+}
+inline void UserBrief::_internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  sex_ = value;
+}
+inline void UserBrief::set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_sex(value);
+  // @@protoc_insertion_point(field_set:clientmsg.UserBrief.sex)
+}
+
+// string desc = 6;
+inline void UserBrief::clear_desc() {
+  desc_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& UserBrief::desc() const {
+  // @@protoc_insertion_point(field_get:clientmsg.UserBrief.desc)
+  return _internal_desc();
+}
+inline void UserBrief::set_desc(const std::string& value) {
+  _internal_set_desc(value);
+  // @@protoc_insertion_point(field_set:clientmsg.UserBrief.desc)
+}
+inline std::string* UserBrief::mutable_desc() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.UserBrief.desc)
+  return _internal_mutable_desc();
+}
+inline const std::string& UserBrief::_internal_desc() const {
+  return desc_.Get();
+}
+inline void UserBrief::_internal_set_desc(const std::string& value) {
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void UserBrief::set_desc(std::string&& value) {
+  
+  desc_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.UserBrief.desc)
+}
+inline void UserBrief::set_desc(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.UserBrief.desc)
+}
+inline void UserBrief::set_desc(const char* value,
+    size_t size) {
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.UserBrief.desc)
+}
+inline std::string* UserBrief::_internal_mutable_desc() {
+  
+  return desc_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* UserBrief::release_desc() {
+  // @@protoc_insertion_point(field_release:clientmsg.UserBrief.desc)
+  return desc_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void UserBrief::set_allocated_desc(std::string* desc) {
+  if (desc != nullptr) {
+    
+  } else {
+    
+  }
+  desc_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), desc,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.UserBrief.desc)
+}
+
+// string back = 7;
+inline void UserBrief::clear_back() {
+  back_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& UserBrief::back() const {
+  // @@protoc_insertion_point(field_get:clientmsg.UserBrief.back)
+  return _internal_back();
+}
+inline void UserBrief::set_back(const std::string& value) {
+  _internal_set_back(value);
+  // @@protoc_insertion_point(field_set:clientmsg.UserBrief.back)
+}
+inline std::string* UserBrief::mutable_back() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.UserBrief.back)
+  return _internal_mutable_back();
+}
+inline const std::string& UserBrief::_internal_back() const {
+  return back_.Get();
+}
+inline void UserBrief::_internal_set_back(const std::string& value) {
+  
+  back_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void UserBrief::set_back(std::string&& value) {
+  
+  back_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.UserBrief.back)
+}
+inline void UserBrief::set_back(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  back_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.UserBrief.back)
+}
+inline void UserBrief::set_back(const char* value,
+    size_t size) {
+  
+  back_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.UserBrief.back)
+}
+inline std::string* UserBrief::_internal_mutable_back() {
+  
+  return back_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* UserBrief::release_back() {
+  // @@protoc_insertion_point(field_release:clientmsg.UserBrief.back)
+  return back_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void UserBrief::set_allocated_back(std::string* back) {
+  if (back != nullptr) {
+    
+  } else {
+    
+  }
+  back_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), back,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.UserBrief.back)
+}
+
+// int32 status = 8;
+inline void UserBrief::clear_status() {
+  status_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 UserBrief::_internal_status() const {
+  return status_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 UserBrief::status() const {
+  // @@protoc_insertion_point(field_get:clientmsg.UserBrief.status)
+  return _internal_status();
+}
+inline void UserBrief::_internal_set_status(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  status_ = value;
+}
+inline void UserBrief::set_status(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:clientmsg.UserBrief.status)
+}
+
+// -------------------------------------------------------------------
+
+// ChatLoginReq
+
+// int32 uid = 1;
+inline void ChatLoginReq::clear_uid() {
+  uid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatLoginReq::_internal_uid() const {
+  return uid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatLoginReq::uid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginReq.uid)
+  return _internal_uid();
+}
+inline void ChatLoginReq::_internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  uid_ = value;
+}
+inline void ChatLoginReq::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginReq.uid)
+}
+
+// string token = 2;
+inline void ChatLoginReq::clear_token() {
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatLoginReq::token() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginReq.token)
+  return _internal_token();
+}
+inline void ChatLoginReq::set_token(const std::string& value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginReq.token)
+}
+inline std::string* ChatLoginReq::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginReq.token)
+  return _internal_mutable_token();
+}
+inline const std::string& ChatLoginReq::_internal_token() const {
+  return token_.Get();
+}
+inline void ChatLoginReq::_internal_set_token(const std::string& value) {
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatLoginReq::set_token(std::string&& value) {
+  
+  token_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.ChatLoginReq.token)
+}
+inline void ChatLoginReq::set_token(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.ChatLoginReq.token)
+}
+inline void ChatLoginReq::set_token(const char* value,
+    size_t size) {
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.ChatLoginReq.token)
+}
+inline std::string* ChatLoginReq::_internal_mutable_token() {
+  
+  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatLoginReq::release_token() {
+  // @@protoc_insertion_point(field_release:clientmsg.ChatLoginReq.token)
+  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatLoginReq::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
+  } else {
+    
+  }
+  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.ChatLoginReq.token)
+}
+
+// string codec = 3;
+inline void ChatLoginReq::clear_codec() {
+  codec_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatLoginReq::codec() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginReq.codec)
+  return _internal_codec();
+}
+inline void ChatLoginReq::set_codec(const std::string& value) {
+  _internal_set_codec(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginReq.codec)
+}
+inline std::string* ChatLoginReq::mutable_codec() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginReq.codec)
+  return _internal_mutable_codec();
+}
+inline const std::string& ChatLoginReq::_internal_codec() const {
+  return codec_.Get();
+}
+inline void ChatLoginReq::_internal_set_codec(const std::string& value) {
+  
+  codec_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatLoginReq::set_codec(std::string&& value) {
+  
+  codec_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.ChatLoginReq.codec)
+}
+inline void ChatLoginReq::set_codec(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  codec_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.ChatLoginReq.codec)
+}
+inline void ChatLoginReq::set_codec(const char* value,
+    size_t size) {
+  
+  codec_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.ChatLoginReq.codec)
+}
+inline std::string* ChatLoginReq::_internal_mutable_codec() {
+  
+  return codec_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatLoginReq::release_codec() {
+  // @@protoc_insertion_point(field_release:clientmsg.ChatLoginReq.codec)
+  return codec_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatLoginReq::set_allocated_codec(std::string* codec) {
+  if (codec != nullptr) {
+    
+  } else {
+    
+  }
+  codec_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), codec,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.ChatLoginReq.codec)
+}
+
+// -------------------------------------------------------------------
+
+// ChatLoginRsp
+
+// int32 error = 1;
+inline void ChatLoginRsp::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatLoginRsp::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatLoginRsp::error() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.error)
+  return _internal_error();
+}
+inline void ChatLoginRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void ChatLoginRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.error)
+}
+
+// int32 uid = 2;
+inline void ChatLoginRsp::clear_uid() {
+  uid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatLoginRsp::_internal_uid() const {
+  return uid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatLoginRsp::uid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.uid)
+  return _internal_uid();
+}
+inline void ChatLoginRsp::_internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  uid_ = value;
+}
+inline void ChatLoginRsp::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.uid)
+}
+
+// string pwd = 3;
+inline void ChatLoginRsp::clear_pwd() {
+  pwd_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatLoginRsp::pwd() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.pwd)
+  return _internal_pwd();
+}
+inline void ChatLoginRsp::set_pwd(const std::string& value) {
+  _internal_set_pwd(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.pwd)
+}
+inline std::string* ChatLoginRsp::mutable_pwd() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginRsp.pwd)
+  return _internal_mutable_pwd();
+}
+inline const std::string& ChatLoginRsp::_internal_pwd() const {
+  return pwd_.Get();
+}
+inline void ChatLoginRsp::_internal_set_pwd(const std::string& value) {
+  
+  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatLoginRsp::set_pwd(std::string&& value) {
+  
+  pwd_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.ChatLoginRsp.pwd)
+}
+inline void ChatLoginRsp::set_pwd(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.ChatLoginRsp.pwd)
+}
+inline void ChatLoginRsp::set_pwd(const char* value,
+    size_t size) {
+  
+  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.ChatLoginRsp.pwd)
+}
+inline std::string* ChatLoginRsp::_internal_mutable_pwd() {
+  
+  return pwd_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatLoginRsp::release_pwd() {
+  // @@protoc_insertion_point(field_release:clientmsg.ChatLoginRsp.pwd)
+  return pwd_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatLoginRsp::set_allocated_pwd(std::string* pwd) {
+  if (pwd != nullptr) {
+    
+  } else {
+    
+  }
+  pwd_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), pwd,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.ChatLoginRsp.pwd)
+}
+
+// string name = 4;
+inline void ChatLoginRsp::clear_name() {
+  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatLoginRsp::name() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.name)
+  return _internal_name();
+}
+inline void ChatLoginRsp::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.name)
+}
+inline std::string* ChatLoginRsp::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginRsp.name)
+  return _internal_mutable_name();
+}
+inline const std::string& ChatLoginRsp::_internal_name() const {
+  return name_.Get();
+}
+inline void ChatLoginRsp::_internal_set_name(const std::string& value) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatLoginRsp::set_name(std::string&& value) {
+  
+  name_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.ChatLoginRsp.name)
+}
+inline void ChatLoginRsp::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.ChatLoginRsp.name)
+}
+inline void ChatLoginRsp::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.ChatLoginRsp.name)
+}
+inline std::string* ChatLoginRsp::_internal_mutable_name() {
+  
+  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatLoginRsp::release_name() {
+  // @@protoc_insertion_point(field_release:clientmsg.ChatLoginRsp.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatLoginRsp::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.ChatLoginRsp.name)
+}
+
+// string email = 5;
+inline void ChatLoginRsp::clear_email() {
+  email_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatLoginRsp::email() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.email)
+  return _internal_email();
+}
+inline void ChatLoginRsp::set_email(const std::string& value) {
+  _internal_set_email(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.email)
+}
+inline std::string* ChatLoginRsp::mutable_email() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginRsp.email)
+  return _internal_mutable_email();
+}
+inline const std::string& ChatLoginRsp::_internal_email() const {
+  return email_.Get();
+}
+inline void ChatLoginRsp::_internal_set_email(const std::string& value) {
+  
+  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatLoginRsp::set_email(std::string&& value) {
+  
+  email_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.ChatLoginRsp.email)
+}
+inline void ChatLoginRsp::set_email(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.ChatLoginRsp.email)
+}
+inline void ChatLoginRsp::set_email(const char* value,
+    size_t size) {
+  
+  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.ChatLoginRsp.email)
+}
+inline std::string* ChatLoginRsp::_internal_mutable_email() {
+  
+  return email_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatLoginRsp::release_email() {
+  // @@protoc_insertion_point(field_release:clientmsg.ChatLoginRsp.email)
+  return email_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatLoginRsp::set_allocated_email(std::string* email) {
+  if (email != nullptr) {
+    
+  } else {
+    
+  }
+  email_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), email,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.ChatLoginRsp.email)
+}
+
+// string nick = 6;
+inline void ChatLoginRsp::clear_nick() {
+  nick_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatLoginRsp::nick() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.nick)
+  return _internal_nick();
+}
+inline void ChatLoginRsp::set_nick(const std::string& value) {
+  _internal_set_nick(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.nick)
+}
+inline std::string* ChatLoginRsp::mutable_nick() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginRsp.nick)
+  return _internal_mutable_nick();
+}
+inline const std::string& ChatLoginRsp::_internal_nick() const {
+  return nick_.Get();
+}
+inline void ChatLoginRsp::_internal_set_nick(const std::string& value) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatLoginRsp::set_nick(std::string&& value) {
+  
+  nick_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.ChatLoginRsp.nick)
+}
+inline void ChatLoginRsp::set_nick(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.ChatLoginRsp.nick)
+}
+inline void ChatLoginRsp::set_nick(const char* value,
+    size_t size) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.ChatLoginRsp.nick)
+}
+inline std::string* ChatLoginRsp::_internal_mutable_nick() {
+  
+  return nick_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatLoginRsp::release_nick() {
+  // @@protoc_insertion_point(field_release:clientmsg.ChatLoginRsp.nick)
+  return nick_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatLoginRsp::set_allocated_nick(std::string* nick) {
+  if (nick != nullptr) {
+    
+  } else {
+    
+  }
+  nick_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nick,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.ChatLoginRsp.nick)
+}
+
+// string desc = 7;
+inline void ChatLoginRsp::clear_desc() {
+  desc_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatLoginRsp::desc() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.desc)
+  return _internal_desc();
+}
+inline void ChatLoginRsp::set_desc(const std::string& value) {
+  _internal_set_desc(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.desc)
+}
+inline std::string* ChatLoginRsp::mutable_desc() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginRsp.desc)
+  return _internal_mutable_desc();
+}
+inline const std::string& ChatLoginRsp::_internal_desc() const {
+  return desc_.Get();
+}
+inline void ChatLoginRsp::_internal_set_desc(const std::string& value) {
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatLoginRsp::set_desc(std::string&& value) {
+  
+  desc_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.ChatLoginRsp.desc)
+}
+inline void ChatLoginRsp::set_desc(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.ChatLoginRsp.desc)
+}
+inline void ChatLoginRsp::set_desc(const char* value,
+    size_t size) {
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.ChatLoginRsp.desc)
+}
+inline std::string* ChatLoginRsp::_internal_mutable_desc() {
+  
+  return desc_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatLoginRsp::release_desc() {
+  // @@protoc_insertion_point(field_release:clientmsg.ChatLoginRsp.desc)
+  return desc_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatLoginRsp::set_allocated_desc(std::string* desc) {
+  if (desc != nullptr) {
+    
+  } else {
+    
+  }
+  desc_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), desc,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.ChatLoginRsp.desc)
+}
+
+// int32 sex = 8;
+inline void ChatLoginRsp::clear_sex() {
+  sex_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatLoginRsp::_internal_sex() const {
+  return sex_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatLoginRsp::sex() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.sex)
+  return _internal_sex();
+}
+inline void ChatLoginRsp::_internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  sex_ = value;
+}
+inline void ChatLoginRsp::set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_sex(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.sex)
+}
+
+// string icon = 9;
+inline void ChatLoginRsp::clear_icon() {
+  icon_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatLoginRsp::icon() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.icon)
+  return _internal_icon();
+}
+inline void ChatLoginRsp::set_icon(const std::string& value) {
+  _internal_set_icon(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.icon)
+}
+inline std::string* ChatLoginRsp::mutable_icon() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginRsp.icon)
+  return _internal_mutable_icon();
+}
+inline const std::string& ChatLoginRsp::_internal_icon() const {
+  return icon_.Get();
+}
+inline void ChatLoginRsp::_internal_set_icon(const std::string& value) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatLoginRsp::set_icon(std::string&& value) {
+  
+  icon_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.ChatLoginRsp.icon)
+}
+inline void ChatLoginRsp::set_icon(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.ChatLoginRsp.icon)
+}
+inline void ChatLoginRsp::set_icon(const char* value,
+    size_t size) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.ChatLoginRsp.icon)
+}
+inline std::string* ChatLoginRsp::_internal_mutable_icon() {
+  
+  return icon_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatLoginRsp::release_icon() {
+  // @@protoc_insertion_point(field_release:clientmsg.ChatLoginRsp.icon)
+  return icon_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatLoginRsp::set_allocated_icon(std::string* icon) {
+  if (icon != nullptr) {
+    
+  } else {
+    
+  }
+  icon_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), icon,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.ChatLoginRsp.icon)
+}
+
+// repeated .clientmsg.UserBrief apply_list = 10;
+inline int ChatLoginRsp::_internal_apply_list_size() const {
+  return apply_list_.size();
+}
+inline int ChatLoginRsp::apply_list_size() const {
+  return _internal_apply_list_size();
+}
+inline void ChatLoginRsp::clear_apply_list() {
+  apply_list_.Clear();
+}
+inline ::clientmsg::UserBrief* ChatLoginRsp::mutable_apply_list(int index) {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginRsp.apply_list)
+  return apply_list_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief >*
+ChatLoginRsp::mutable_apply_list() {
+  // @@protoc_insertion_point(field_mutable_list:clientmsg.ChatLoginRsp.apply_list)
+  return &apply_list_;
+}
+inline const ::clientmsg::UserBrief& ChatLoginRsp::_internal_apply_list(int index) const {
+  return apply_list_.Get(index);
+}
+inline const ::clientmsg::UserBrief& ChatLoginRsp::apply_list(int index) const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.apply_list)
+  return _internal_apply_list(index);
+}
+inline ::clientmsg::UserBrief* ChatLoginRsp::_internal_add_apply_list() {
+  return apply_list_.Add();
+}
+inline ::clientmsg::UserBrief* ChatLoginRsp::add_apply_list() {
+  // @@protoc_insertion_point(field_add:clientmsg.ChatLoginRsp.apply_list)
+  return _internal_add_apply_list();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief >&
+ChatLoginRsp::apply_list() const {
+  // @@protoc_insertion_point(field_list:clientmsg.ChatLoginRsp.apply_list)
+  return apply_list_;
+}
+
+// repeated .clientmsg.UserBrief friend_list = 11;
+inline int ChatLoginRsp::_internal_friend_list_size() const {
+  return friend_list_.size();
+}
+inline int ChatLoginRsp::friend_list_size() const {
+  return _internal_friend_list_size();
+}
+inline void ChatLoginRsp::clear_friend_list() {
+  friend_list_.Clear();
+}
+inline ::clientmsg::UserBrief* ChatLoginRsp::mutable_friend_list(int index) {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginRsp.friend_list)
+  return friend_list_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief >*
+ChatLoginRsp::mutable_friend_list() {
+  // @@protoc_insertion_point(field_mutable_list:clientmsg.ChatLoginRsp.friend_list)
+  return &friend_list_;
+}
+inline const ::clientmsg::UserBrief& ChatLoginRsp::_internal_friend_list(int index) const {
+  return friend_list_.Get(index);
+}
+inline const ::clientmsg::UserBrief& ChatLoginRsp::friend_list(int index) const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.friend_list)
+  return _internal_friend_list(index);
+}
+inline ::clientmsg::UserBrief* ChatLoginRsp::_internal_add_friend_list() {
+  return friend_list_.Add();
+}
+inline ::clientmsg::UserBrief* ChatLoginRsp::add_friend_list() {
+  // @@protoc_insertion_point(field_add:clientmsg.ChatLoginRsp.friend_list)
+  return _internal_add_friend_list();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::UserBrief >&
+ChatLoginRsp::friend_list() const {
+  // @@protoc_insertion_point(field_list:clientmsg.ChatLoginRsp.friend_list)
+  return friend_list_;
+}
+
+// string codec = 12;
+inline void ChatLoginRsp::clear_codec() {
+  codec_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatLoginRsp::codec() const {
+  // @@protoc_insertion_point(field_get:clientmsg.ChatLoginRsp.codec)
+  return _internal_codec();
+}
+inline void ChatLoginRsp::set_codec(const std::string& value) {
+  _internal_set_codec(value);
+  // @@protoc_insertion_point(field_set:clientmsg.ChatLoginRsp.codec)
+}
+inline std::string* ChatLoginRsp::mutable_codec() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.ChatLoginRsp.codec)
+  return _internal_mutable_codec();
+}
+inline const std::string& ChatLoginRsp::_internal_codec() const {
+  return codec_.Get();
+}
+inline void ChatLoginRsp::_internal_set_codec(const std::string& value) {
+  
+  codec_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatLoginRsp::set_codec(std::string&& value) {
+  
+  codec_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.ChatLoginRsp.codec)
+}
+inline void ChatLoginRsp::set_codec(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  codec_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.ChatLoginRsp.codec)
+}
+inline void ChatLoginRsp::set_codec(const char* value,
+    size_t size) {
+  
+  codec_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.ChatLoginRsp.codec)
+}
+inline std::string* ChatLoginRsp::_internal_mutable_codec() {
+  
+  return codec_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatLoginRsp::release_codec() {
+  // @@protoc_insertion_point(field_release:clientmsg.ChatLoginRsp.codec)
+  return codec_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatLoginRsp::set_allocated_codec(std::string* codec) {
+  if (codec != nullptr) {
+    
+  } else {
+    
+  }
+  codec_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), codec,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.ChatLoginRsp.codec)
+}
+
+// -------------------------------------------------------------------
+
+// SearchUserReq
+
+// string uid = 1;
+inline void SearchUserReq::clear_uid() {
+  uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SearchUserReq::uid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserReq.uid)
+  return _internal_uid();
+}
+inline void SearchUserReq::set_uid(const std::string& value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserReq.uid)
+}
+inline std::string* SearchUserReq::mutable_uid() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.SearchUserReq.uid)
+  return _internal_mutable_uid();
+}
+inline const std::string& SearchUserReq::_internal_uid() const {
+  return uid_.Get();
+}
+inline void SearchUserReq::_internal_set_uid(const std::string& value) {
+  
+  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SearchUserReq::set_uid(std::string&& value) {
+  
+  uid_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.SearchUserReq.uid)
+}
+inline void SearchUserReq::set_uid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.SearchUserReq.uid)
+}
+inline void SearchUserReq::set_uid(const char* value,
+    size_t size) {
+  
+  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.SearchUserReq.uid)
+}
+inline std::string* SearchUserReq::_internal_mutable_uid() {
+  
+  return uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SearchUserReq::release_uid() {
+  // @@protoc_insertion_point(field_release:clientmsg.SearchUserReq.uid)
+  return uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SearchUserReq::set_allocated_uid(std::string* uid) {
+  if (uid != nullptr) {
+    
+  } else {
+    
+  }
+  uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), uid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.SearchUserReq.uid)
+}
+
+// -------------------------------------------------------------------
+
+// SearchUserRsp
+
+// int32 error = 1;
+inline void SearchUserRsp::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SearchUserRsp::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SearchUserRsp::error() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserRsp.error)
+  return _internal_error();
+}
+inline void SearchUserRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void SearchUserRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserRsp.error)
+}
+
+// int32 uid = 2;
+inline void SearchUserRsp::clear_uid() {
+  uid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SearchUserRsp::_internal_uid() const {
+  return uid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SearchUserRsp::uid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserRsp.uid)
+  return _internal_uid();
+}
+inline void SearchUserRsp::_internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  uid_ = value;
+}
+inline void SearchUserRsp::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserRsp.uid)
+}
+
+// string pwd = 3;
+inline void SearchUserRsp::clear_pwd() {
+  pwd_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SearchUserRsp::pwd() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserRsp.pwd)
+  return _internal_pwd();
+}
+inline void SearchUserRsp::set_pwd(const std::string& value) {
+  _internal_set_pwd(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserRsp.pwd)
+}
+inline std::string* SearchUserRsp::mutable_pwd() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.SearchUserRsp.pwd)
+  return _internal_mutable_pwd();
+}
+inline const std::string& SearchUserRsp::_internal_pwd() const {
+  return pwd_.Get();
+}
+inline void SearchUserRsp::_internal_set_pwd(const std::string& value) {
+  
+  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SearchUserRsp::set_pwd(std::string&& value) {
+  
+  pwd_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.SearchUserRsp.pwd)
+}
+inline void SearchUserRsp::set_pwd(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.SearchUserRsp.pwd)
+}
+inline void SearchUserRsp::set_pwd(const char* value,
+    size_t size) {
+  
+  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.SearchUserRsp.pwd)
+}
+inline std::string* SearchUserRsp::_internal_mutable_pwd() {
+  
+  return pwd_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SearchUserRsp::release_pwd() {
+  // @@protoc_insertion_point(field_release:clientmsg.SearchUserRsp.pwd)
+  return pwd_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SearchUserRsp::set_allocated_pwd(std::string* pwd) {
+  if (pwd != nullptr) {
+    
+  } else {
+    
+  }
+  pwd_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), pwd,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.SearchUserRsp.pwd)
+}
+
+// string name = 4;
+inline void SearchUserRsp::clear_name() {
+  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SearchUserRsp::name() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserRsp.name)
+  return _internal_name();
+}
+inline void SearchUserRsp::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserRsp.name)
+}
+inline std::string* SearchUserRsp::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.SearchUserRsp.name)
+  return _internal_mutable_name();
+}
+inline const std::string& SearchUserRsp::_internal_name() const {
+  return name_.Get();
+}
+inline void SearchUserRsp::_internal_set_name(const std::string& value) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SearchUserRsp::set_name(std::string&& value) {
+  
+  name_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.SearchUserRsp.name)
+}
+inline void SearchUserRsp::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.SearchUserRsp.name)
+}
+inline void SearchUserRsp::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.SearchUserRsp.name)
+}
+inline std::string* SearchUserRsp::_internal_mutable_name() {
+  
+  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SearchUserRsp::release_name() {
+  // @@protoc_insertion_point(field_release:clientmsg.SearchUserRsp.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SearchUserRsp::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.SearchUserRsp.name)
+}
+
+// string email = 5;
+inline void SearchUserRsp::clear_email() {
+  email_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SearchUserRsp::email() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserRsp.email)
+  return _internal_email();
+}
+inline void SearchUserRsp::set_email(const std::string& value) {
+  _internal_set_email(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserRsp.email)
+}
+inline std::string* SearchUserRsp::mutable_email() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.SearchUserRsp.email)
+  return _internal_mutable_email();
+}
+inline const std::string& SearchUserRsp::_internal_email() const {
+  return email_.Get();
+}
+inline void SearchUserRsp::_internal_set_email(const std::string& value) {
+  
+  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SearchUserRsp::set_email(std::string&& value) {
+  
+  email_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.SearchUserRsp.email)
+}
+inline void SearchUserRsp::set_email(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.SearchUserRsp.email)
+}
+inline void SearchUserRsp::set_email(const char* value,
+    size_t size) {
+  
+  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.SearchUserRsp.email)
+}
+inline std::string* SearchUserRsp::_internal_mutable_email() {
+  
+  return email_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SearchUserRsp::release_email() {
+  // @@protoc_insertion_point(field_release:clientmsg.SearchUserRsp.email)
+  return email_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SearchUserRsp::set_allocated_email(std::string* email) {
+  if (email != nullptr) {
+    
+  } else {
+    
+  }
+  email_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), email,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.SearchUserRsp.email)
+}
+
+// string nick = 6;
+inline void SearchUserRsp::clear_nick() {
+  nick_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SearchUserRsp::nick() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserRsp.nick)
+  return _internal_nick();
+}
+inline void SearchUserRsp::set_nick(const std::string& value) {
+  _internal_set_nick(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserRsp.nick)
+}
+inline std::string* SearchUserRsp::mutable_nick() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.SearchUserRsp.nick)
+  return _internal_mutable_nick();
+}
+inline const std::string& SearchUserRsp::_internal_nick() const {
+  return nick_.Get();
+}
+inline void SearchUserRsp::_internal_set_nick(const std::string& value) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SearchUserRsp::set_nick(std::string&& value) {
+  
+  nick_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.SearchUserRsp.nick)
+}
+inline void SearchUserRsp::set_nick(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.SearchUserRsp.nick)
+}
+inline void SearchUserRsp::set_nick(const char* value,
+    size_t size) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.SearchUserRsp.nick)
+}
+inline std::string* SearchUserRsp::_internal_mutable_nick() {
+  
+  return nick_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SearchUserRsp::release_nick() {
+  // @@protoc_insertion_point(field_release:clientmsg.SearchUserRsp.nick)
+  return nick_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SearchUserRsp::set_allocated_nick(std::string* nick) {
+  if (nick != nullptr) {
+    
+  } else {
+    
+  }
+  nick_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nick,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.SearchUserRsp.nick)
+}
+
+// string desc = 7;
+inline void SearchUserRsp::clear_desc() {
+  desc_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SearchUserRsp::desc() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserRsp.desc)
+  return _internal_desc();
+}
+inline void SearchUserRsp::set_desc(const std::string& value) {
+  _internal_set_desc(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserRsp.desc)
+}
+inline std::string* SearchUserRsp::mutable_desc() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.SearchUserRsp.desc)
+  return _internal_mutable_desc();
+}
+inline const std::string& SearchUserRsp::_internal_desc() const {
+  return desc_.Get();
+}
+inline void SearchUserRsp::_internal_set_desc(const std::string& value) {
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SearchUserRsp::set_desc(std::string&& value) {
+  
+  desc_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.SearchUserRsp.desc)
+}
+inline void SearchUserRsp::set_desc(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.SearchUserRsp.desc)
+}
+inline void SearchUserRsp::set_desc(const char* value,
+    size_t size) {
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.SearchUserRsp.desc)
+}
+inline std::string* SearchUserRsp::_internal_mutable_desc() {
+  
+  return desc_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SearchUserRsp::release_desc() {
+  // @@protoc_insertion_point(field_release:clientmsg.SearchUserRsp.desc)
+  return desc_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SearchUserRsp::set_allocated_desc(std::string* desc) {
+  if (desc != nullptr) {
+    
+  } else {
+    
+  }
+  desc_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), desc,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.SearchUserRsp.desc)
+}
+
+// int32 sex = 8;
+inline void SearchUserRsp::clear_sex() {
+  sex_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SearchUserRsp::_internal_sex() const {
+  return sex_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SearchUserRsp::sex() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserRsp.sex)
+  return _internal_sex();
+}
+inline void SearchUserRsp::_internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  sex_ = value;
+}
+inline void SearchUserRsp::set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_sex(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserRsp.sex)
+}
+
+// string icon = 9;
+inline void SearchUserRsp::clear_icon() {
+  icon_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SearchUserRsp::icon() const {
+  // @@protoc_insertion_point(field_get:clientmsg.SearchUserRsp.icon)
+  return _internal_icon();
+}
+inline void SearchUserRsp::set_icon(const std::string& value) {
+  _internal_set_icon(value);
+  // @@protoc_insertion_point(field_set:clientmsg.SearchUserRsp.icon)
+}
+inline std::string* SearchUserRsp::mutable_icon() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.SearchUserRsp.icon)
+  return _internal_mutable_icon();
+}
+inline const std::string& SearchUserRsp::_internal_icon() const {
+  return icon_.Get();
+}
+inline void SearchUserRsp::_internal_set_icon(const std::string& value) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SearchUserRsp::set_icon(std::string&& value) {
+  
+  icon_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.SearchUserRsp.icon)
+}
+inline void SearchUserRsp::set_icon(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.SearchUserRsp.icon)
+}
+inline void SearchUserRsp::set_icon(const char* value,
+    size_t size) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.SearchUserRsp.icon)
+}
+inline std::string* SearchUserRsp::_internal_mutable_icon() {
+  
+  return icon_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SearchUserRsp::release_icon() {
+  // @@protoc_insertion_point(field_release:clientmsg.SearchUserRsp.icon)
+  return icon_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SearchUserRsp::set_allocated_icon(std::string* icon) {
+  if (icon != nullptr) {
+    
+  } else {
+    
+  }
+  icon_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), icon,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.SearchUserRsp.icon)
+}
+
+// -------------------------------------------------------------------
+
+// AddFriendApplyReq
+
+// int32 uid = 1;
+inline void AddFriendApplyReq::clear_uid() {
+  uid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendApplyReq::_internal_uid() const {
+  return uid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendApplyReq::uid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AddFriendApplyReq.uid)
+  return _internal_uid();
+}
+inline void AddFriendApplyReq::_internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  uid_ = value;
+}
+inline void AddFriendApplyReq::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AddFriendApplyReq.uid)
+}
+
+// string applyname = 2;
+inline void AddFriendApplyReq::clear_applyname() {
+  applyname_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AddFriendApplyReq::applyname() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AddFriendApplyReq.applyname)
+  return _internal_applyname();
+}
+inline void AddFriendApplyReq::set_applyname(const std::string& value) {
+  _internal_set_applyname(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AddFriendApplyReq.applyname)
+}
+inline std::string* AddFriendApplyReq::mutable_applyname() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.AddFriendApplyReq.applyname)
+  return _internal_mutable_applyname();
+}
+inline const std::string& AddFriendApplyReq::_internal_applyname() const {
+  return applyname_.Get();
+}
+inline void AddFriendApplyReq::_internal_set_applyname(const std::string& value) {
+  
+  applyname_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AddFriendApplyReq::set_applyname(std::string&& value) {
+  
+  applyname_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.AddFriendApplyReq.applyname)
+}
+inline void AddFriendApplyReq::set_applyname(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  applyname_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.AddFriendApplyReq.applyname)
+}
+inline void AddFriendApplyReq::set_applyname(const char* value,
+    size_t size) {
+  
+  applyname_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.AddFriendApplyReq.applyname)
+}
+inline std::string* AddFriendApplyReq::_internal_mutable_applyname() {
+  
+  return applyname_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AddFriendApplyReq::release_applyname() {
+  // @@protoc_insertion_point(field_release:clientmsg.AddFriendApplyReq.applyname)
+  return applyname_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AddFriendApplyReq::set_allocated_applyname(std::string* applyname) {
+  if (applyname != nullptr) {
+    
+  } else {
+    
+  }
+  applyname_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), applyname,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.AddFriendApplyReq.applyname)
+}
+
+// string bakname = 3;
+inline void AddFriendApplyReq::clear_bakname() {
+  bakname_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AddFriendApplyReq::bakname() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AddFriendApplyReq.bakname)
+  return _internal_bakname();
+}
+inline void AddFriendApplyReq::set_bakname(const std::string& value) {
+  _internal_set_bakname(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AddFriendApplyReq.bakname)
+}
+inline std::string* AddFriendApplyReq::mutable_bakname() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.AddFriendApplyReq.bakname)
+  return _internal_mutable_bakname();
+}
+inline const std::string& AddFriendApplyReq::_internal_bakname() const {
+  return bakname_.Get();
+}
+inline void AddFriendApplyReq::_internal_set_bakname(const std::string& value) {
+  
+  bakname_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AddFriendApplyReq::set_bakname(std::string&& value) {
+  
+  bakname_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.AddFriendApplyReq.bakname)
+}
+inline void AddFriendApplyReq::set_bakname(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  bakname_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.AddFriendApplyReq.bakname)
+}
+inline void AddFriendApplyReq::set_bakname(const char* value,
+    size_t size) {
+  
+  bakname_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.AddFriendApplyReq.bakname)
+}
+inline std::string* AddFriendApplyReq::_internal_mutable_bakname() {
+  
+  return bakname_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AddFriendApplyReq::release_bakname() {
+  // @@protoc_insertion_point(field_release:clientmsg.AddFriendApplyReq.bakname)
+  return bakname_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AddFriendApplyReq::set_allocated_bakname(std::string* bakname) {
+  if (bakname != nullptr) {
+    
+  } else {
+    
+  }
+  bakname_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), bakname,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.AddFriendApplyReq.bakname)
+}
+
+// int32 touid = 4;
+inline void AddFriendApplyReq::clear_touid() {
+  touid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendApplyReq::_internal_touid() const {
+  return touid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendApplyReq::touid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AddFriendApplyReq.touid)
+  return _internal_touid();
+}
+inline void AddFriendApplyReq::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  touid_ = value;
+}
+inline void AddFriendApplyReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_touid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AddFriendApplyReq.touid)
+}
+
+// -------------------------------------------------------------------
+
+// AddFriendApplyRsp
+
+// int32 error = 1;
+inline void AddFriendApplyRsp::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendApplyRsp::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendApplyRsp::error() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AddFriendApplyRsp.error)
+  return _internal_error();
+}
+inline void AddFriendApplyRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void AddFriendApplyRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AddFriendApplyRsp.error)
+}
+
+// -------------------------------------------------------------------
+
+// NotifyAddFriendReq
+
+// int32 error = 1;
+inline void NotifyAddFriendReq::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAddFriendReq::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAddFriendReq::error() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAddFriendReq.error)
+  return _internal_error();
+}
+inline void NotifyAddFriendReq::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void NotifyAddFriendReq::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAddFriendReq.error)
+}
+
+// int32 applyuid = 2;
+inline void NotifyAddFriendReq::clear_applyuid() {
+  applyuid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAddFriendReq::_internal_applyuid() const {
+  return applyuid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAddFriendReq::applyuid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAddFriendReq.applyuid)
+  return _internal_applyuid();
+}
+inline void NotifyAddFriendReq::_internal_set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  applyuid_ = value;
+}
+inline void NotifyAddFriendReq::set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_applyuid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAddFriendReq.applyuid)
+}
+
+// string name = 3;
+inline void NotifyAddFriendReq::clear_name() {
+  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& NotifyAddFriendReq::name() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAddFriendReq.name)
+  return _internal_name();
+}
+inline void NotifyAddFriendReq::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAddFriendReq.name)
+}
+inline std::string* NotifyAddFriendReq::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.NotifyAddFriendReq.name)
+  return _internal_mutable_name();
+}
+inline const std::string& NotifyAddFriendReq::_internal_name() const {
+  return name_.Get();
+}
+inline void NotifyAddFriendReq::_internal_set_name(const std::string& value) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void NotifyAddFriendReq::set_name(std::string&& value) {
+  
+  name_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.NotifyAddFriendReq.name)
+}
+inline void NotifyAddFriendReq::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.NotifyAddFriendReq.name)
+}
+inline void NotifyAddFriendReq::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.NotifyAddFriendReq.name)
+}
+inline std::string* NotifyAddFriendReq::_internal_mutable_name() {
+  
+  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* NotifyAddFriendReq::release_name() {
+  // @@protoc_insertion_point(field_release:clientmsg.NotifyAddFriendReq.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void NotifyAddFriendReq::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.NotifyAddFriendReq.name)
+}
+
+// string desc = 4;
+inline void NotifyAddFriendReq::clear_desc() {
+  desc_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& NotifyAddFriendReq::desc() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAddFriendReq.desc)
+  return _internal_desc();
+}
+inline void NotifyAddFriendReq::set_desc(const std::string& value) {
+  _internal_set_desc(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAddFriendReq.desc)
+}
+inline std::string* NotifyAddFriendReq::mutable_desc() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.NotifyAddFriendReq.desc)
+  return _internal_mutable_desc();
+}
+inline const std::string& NotifyAddFriendReq::_internal_desc() const {
+  return desc_.Get();
+}
+inline void NotifyAddFriendReq::_internal_set_desc(const std::string& value) {
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void NotifyAddFriendReq::set_desc(std::string&& value) {
+  
+  desc_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.NotifyAddFriendReq.desc)
+}
+inline void NotifyAddFriendReq::set_desc(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.NotifyAddFriendReq.desc)
+}
+inline void NotifyAddFriendReq::set_desc(const char* value,
+    size_t size) {
+  
+  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.NotifyAddFriendReq.desc)
+}
+inline std::string* NotifyAddFriendReq::_internal_mutable_desc() {
+  
+  return desc_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* NotifyAddFriendReq::release_desc() {
+  // @@protoc_insertion_point(field_release:clientmsg.NotifyAddFriendReq.desc)
+  return desc_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void NotifyAddFriendReq::set_allocated_desc(std::string* desc) {
+  if (desc != nullptr) {
+    
+  } else {
+    
+  }
+  desc_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), desc,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.NotifyAddFriendReq.desc)
+}
+
+// string icon = 5;
+inline void NotifyAddFriendReq::clear_icon() {
+  icon_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& NotifyAddFriendReq::icon() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAddFriendReq.icon)
+  return _internal_icon();
+}
+inline void NotifyAddFriendReq::set_icon(const std::string& value) {
+  _internal_set_icon(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAddFriendReq.icon)
+}
+inline std::string* NotifyAddFriendReq::mutable_icon() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.NotifyAddFriendReq.icon)
+  return _internal_mutable_icon();
+}
+inline const std::string& NotifyAddFriendReq::_internal_icon() const {
+  return icon_.Get();
+}
+inline void NotifyAddFriendReq::_internal_set_icon(const std::string& value) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void NotifyAddFriendReq::set_icon(std::string&& value) {
+  
+  icon_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.NotifyAddFriendReq.icon)
+}
+inline void NotifyAddFriendReq::set_icon(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.NotifyAddFriendReq.icon)
+}
+inline void NotifyAddFriendReq::set_icon(const char* value,
+    size_t size) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.NotifyAddFriendReq.icon)
+}
+inline std::string* NotifyAddFriendReq::_internal_mutable_icon() {
+  
+  return icon_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* NotifyAddFriendReq::release_icon() {
+  // @@protoc_insertion_point(field_release:clientmsg.NotifyAddFriendReq.icon)
+  return icon_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void NotifyAddFriendReq::set_allocated_icon(std::string* icon) {
+  if (icon != nullptr) {
+    
+  } else {
+    
+  }
+  icon_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), icon,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.NotifyAddFriendReq.icon)
+}
+
+// int32 sex = 6;
+inline void NotifyAddFriendReq::clear_sex() {
+  sex_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAddFriendReq::_internal_sex() const {
+  return sex_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAddFriendReq::sex() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAddFriendReq.sex)
+  return _internal_sex();
+}
+inline void NotifyAddFriendReq::_internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  sex_ = value;
+}
+inline void NotifyAddFriendReq::set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_sex(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAddFriendReq.sex)
+}
+
+// string nick = 7;
+inline void NotifyAddFriendReq::clear_nick() {
+  nick_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& NotifyAddFriendReq::nick() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAddFriendReq.nick)
+  return _internal_nick();
+}
+inline void NotifyAddFriendReq::set_nick(const std::string& value) {
+  _internal_set_nick(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAddFriendReq.nick)
+}
+inline std::string* NotifyAddFriendReq::mutable_nick() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.NotifyAddFriendReq.nick)
+  return _internal_mutable_nick();
+}
+inline const std::string& NotifyAddFriendReq::_internal_nick() const {
+  return nick_.Get();
+}
+inline void NotifyAddFriendReq::_internal_set_nick(const std::string& value) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void NotifyAddFriendReq::set_nick(std::string&& value) {
+  
+  nick_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.NotifyAddFriendReq.nick)
+}
+inline void NotifyAddFriendReq::set_nick(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.NotifyAddFriendReq.nick)
+}
+inline void NotifyAddFriendReq::set_nick(const char* value,
+    size_t size) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.NotifyAddFriendReq.nick)
+}
+inline std::string* NotifyAddFriendReq::_internal_mutable_nick() {
+  
+  return nick_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* NotifyAddFriendReq::release_nick() {
+  // @@protoc_insertion_point(field_release:clientmsg.NotifyAddFriendReq.nick)
+  return nick_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void NotifyAddFriendReq::set_allocated_nick(std::string* nick) {
+  if (nick != nullptr) {
+    
+  } else {
+    
+  }
+  nick_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nick,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.NotifyAddFriendReq.nick)
+}
+
+// -------------------------------------------------------------------
+
+// AuthFriendApplyReq
+
+// int32 fromuid = 1;
+inline void AuthFriendApplyReq::clear_fromuid() {
+  fromuid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyReq::_internal_fromuid() const {
+  return fromuid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyReq::fromuid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AuthFriendApplyReq.fromuid)
+  return _internal_fromuid();
+}
+inline void AuthFriendApplyReq::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  fromuid_ = value;
+}
+inline void AuthFriendApplyReq::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_fromuid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AuthFriendApplyReq.fromuid)
+}
+
+// int32 touid = 2;
+inline void AuthFriendApplyReq::clear_touid() {
+  touid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyReq::_internal_touid() const {
+  return touid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyReq::touid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AuthFriendApplyReq.touid)
+  return _internal_touid();
+}
+inline void AuthFriendApplyReq::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  touid_ = value;
+}
+inline void AuthFriendApplyReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_touid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AuthFriendApplyReq.touid)
+}
+
+// string back = 3;
+inline void AuthFriendApplyReq::clear_back() {
+  back_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AuthFriendApplyReq::back() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AuthFriendApplyReq.back)
+  return _internal_back();
+}
+inline void AuthFriendApplyReq::set_back(const std::string& value) {
+  _internal_set_back(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AuthFriendApplyReq.back)
+}
+inline std::string* AuthFriendApplyReq::mutable_back() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.AuthFriendApplyReq.back)
+  return _internal_mutable_back();
+}
+inline const std::string& AuthFriendApplyReq::_internal_back() const {
+  return back_.Get();
+}
+inline void AuthFriendApplyReq::_internal_set_back(const std::string& value) {
+  
+  back_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AuthFriendApplyReq::set_back(std::string&& value) {
+  
+  back_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.AuthFriendApplyReq.back)
+}
+inline void AuthFriendApplyReq::set_back(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  back_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.AuthFriendApplyReq.back)
+}
+inline void AuthFriendApplyReq::set_back(const char* value,
+    size_t size) {
+  
+  back_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.AuthFriendApplyReq.back)
+}
+inline std::string* AuthFriendApplyReq::_internal_mutable_back() {
+  
+  return back_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AuthFriendApplyReq::release_back() {
+  // @@protoc_insertion_point(field_release:clientmsg.AuthFriendApplyReq.back)
+  return back_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AuthFriendApplyReq::set_allocated_back(std::string* back) {
+  if (back != nullptr) {
+    
+  } else {
+    
+  }
+  back_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), back,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.AuthFriendApplyReq.back)
+}
+
+// -------------------------------------------------------------------
+
+// AuthFriendApplyRsp
+
+// int32 error = 1;
+inline void AuthFriendApplyRsp::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyRsp::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyRsp::error() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AuthFriendApplyRsp.error)
+  return _internal_error();
+}
+inline void AuthFriendApplyRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void AuthFriendApplyRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AuthFriendApplyRsp.error)
+}
+
+// int32 uid = 2;
+inline void AuthFriendApplyRsp::clear_uid() {
+  uid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyRsp::_internal_uid() const {
+  return uid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyRsp::uid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AuthFriendApplyRsp.uid)
+  return _internal_uid();
+}
+inline void AuthFriendApplyRsp::_internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  uid_ = value;
+}
+inline void AuthFriendApplyRsp::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AuthFriendApplyRsp.uid)
+}
+
+// string name = 3;
+inline void AuthFriendApplyRsp::clear_name() {
+  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AuthFriendApplyRsp::name() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AuthFriendApplyRsp.name)
+  return _internal_name();
+}
+inline void AuthFriendApplyRsp::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AuthFriendApplyRsp.name)
+}
+inline std::string* AuthFriendApplyRsp::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.AuthFriendApplyRsp.name)
+  return _internal_mutable_name();
+}
+inline const std::string& AuthFriendApplyRsp::_internal_name() const {
+  return name_.Get();
+}
+inline void AuthFriendApplyRsp::_internal_set_name(const std::string& value) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AuthFriendApplyRsp::set_name(std::string&& value) {
+  
+  name_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.AuthFriendApplyRsp.name)
+}
+inline void AuthFriendApplyRsp::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.AuthFriendApplyRsp.name)
+}
+inline void AuthFriendApplyRsp::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.AuthFriendApplyRsp.name)
+}
+inline std::string* AuthFriendApplyRsp::_internal_mutable_name() {
+  
+  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AuthFriendApplyRsp::release_name() {
+  // @@protoc_insertion_point(field_release:clientmsg.AuthFriendApplyRsp.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AuthFriendApplyRsp::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.AuthFriendApplyRsp.name)
+}
+
+// string nick = 4;
+inline void AuthFriendApplyRsp::clear_nick() {
+  nick_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AuthFriendApplyRsp::nick() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AuthFriendApplyRsp.nick)
+  return _internal_nick();
+}
+inline void AuthFriendApplyRsp::set_nick(const std::string& value) {
+  _internal_set_nick(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AuthFriendApplyRsp.nick)
+}
+inline std::string* AuthFriendApplyRsp::mutable_nick() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.AuthFriendApplyRsp.nick)
+  return _internal_mutable_nick();
+}
+inline const std::string& AuthFriendApplyRsp::_internal_nick() const {
+  return nick_.Get();
+}
+inline void AuthFriendApplyRsp::_internal_set_nick(const std::string& value) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AuthFriendApplyRsp::set_nick(std::string&& value) {
+  
+  nick_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.AuthFriendApplyRsp.nick)
+}
+inline void AuthFriendApplyRsp::set_nick(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.AuthFriendApplyRsp.nick)
+}
+inline void AuthFriendApplyRsp::set_nick(const char* value,
+    size_t size) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.AuthFriendApplyRsp.nick)
+}
+inline std::string* AuthFriendApplyRsp::_internal_mutable_nick() {
+  
+  return nick_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AuthFriendApplyRsp::release_nick() {
+  // @@protoc_insertion_point(field_release:clientmsg.AuthFriendApplyRsp.nick)
+  return nick_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AuthFriendApplyRsp::set_allocated_nick(std::string* nick) {
+  if (nick != nullptr) {
+    
+  } else {
+    
+  }
+  nick_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nick,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.AuthFriendApplyRsp.nick)
+}
+
+// string icon = 5;
+inline void AuthFriendApplyRsp::clear_icon() {
+  icon_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AuthFriendApplyRsp::icon() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AuthFriendApplyRsp.icon)
+  return _internal_icon();
+}
+inline void AuthFriendApplyRsp::set_icon(const std::string& value) {
+  _internal_set_icon(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AuthFriendApplyRsp.icon)
+}
+inline std::string* AuthFriendApplyRsp::mutable_icon() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.AuthFriendApplyRsp.icon)
+  return _internal_mutable_icon();
+}
+inline const std::string& AuthFriendApplyRsp::_internal_icon() const {
+  return icon_.Get();
+}
+inline void AuthFriendApplyRsp::_internal_set_icon(const std::string& value) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AuthFriendApplyRsp::set_icon(std::string&& value) {
+  
+  icon_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.AuthFriendApplyRsp.icon)
+}
+inline void AuthFriendApplyRsp::set_icon(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.AuthFriendApplyRsp.icon)
+}
+inline void AuthFriendApplyRsp::set_icon(const char* value,
+    size_t size) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.AuthFriendApplyRsp.icon)
+}
+inline std::string* AuthFriendApplyRsp::_internal_mutable_icon() {
+  
+  return icon_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AuthFriendApplyRsp::release_icon() {
+  // @@protoc_insertion_point(field_release:clientmsg.AuthFriendApplyRsp.icon)
+  return icon_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AuthFriendApplyRsp::set_allocated_icon(std::string* icon) {
+  if (icon != nullptr) {
+    
+  } else {
+    
+  }
+  icon_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), icon,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.AuthFriendApplyRsp.icon)
+}
+
+// int32 sex = 6;
+inline void AuthFriendApplyRsp::clear_sex() {
+  sex_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyRsp::_internal_sex() const {
+  return sex_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendApplyRsp::sex() const {
+  // @@protoc_insertion_point(field_get:clientmsg.AuthFriendApplyRsp.sex)
+  return _internal_sex();
+}
+inline void AuthFriendApplyRsp::_internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  sex_ = value;
+}
+inline void AuthFriendApplyRsp::set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_sex(value);
+  // @@protoc_insertion_point(field_set:clientmsg.AuthFriendApplyRsp.sex)
+}
+
+// -------------------------------------------------------------------
+
+// NotifyAuthFriendReq
+
+// int32 error = 1;
+inline void NotifyAuthFriendReq::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAuthFriendReq::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAuthFriendReq::error() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAuthFriendReq.error)
+  return _internal_error();
+}
+inline void NotifyAuthFriendReq::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void NotifyAuthFriendReq::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAuthFriendReq.error)
+}
+
+// int32 fromuid = 2;
+inline void NotifyAuthFriendReq::clear_fromuid() {
+  fromuid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAuthFriendReq::_internal_fromuid() const {
+  return fromuid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAuthFriendReq::fromuid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAuthFriendReq.fromuid)
+  return _internal_fromuid();
+}
+inline void NotifyAuthFriendReq::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  fromuid_ = value;
+}
+inline void NotifyAuthFriendReq::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_fromuid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAuthFriendReq.fromuid)
+}
+
+// int32 touid = 3;
+inline void NotifyAuthFriendReq::clear_touid() {
+  touid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAuthFriendReq::_internal_touid() const {
+  return touid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAuthFriendReq::touid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAuthFriendReq.touid)
+  return _internal_touid();
+}
+inline void NotifyAuthFriendReq::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  touid_ = value;
+}
+inline void NotifyAuthFriendReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_touid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAuthFriendReq.touid)
+}
+
+// string name = 4;
+inline void NotifyAuthFriendReq::clear_name() {
+  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& NotifyAuthFriendReq::name() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAuthFriendReq.name)
+  return _internal_name();
+}
+inline void NotifyAuthFriendReq::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAuthFriendReq.name)
+}
+inline std::string* NotifyAuthFriendReq::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.NotifyAuthFriendReq.name)
+  return _internal_mutable_name();
+}
+inline const std::string& NotifyAuthFriendReq::_internal_name() const {
+  return name_.Get();
+}
+inline void NotifyAuthFriendReq::_internal_set_name(const std::string& value) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void NotifyAuthFriendReq::set_name(std::string&& value) {
+  
+  name_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.NotifyAuthFriendReq.name)
+}
+inline void NotifyAuthFriendReq::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.NotifyAuthFriendReq.name)
+}
+inline void NotifyAuthFriendReq::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.NotifyAuthFriendReq.name)
+}
+inline std::string* NotifyAuthFriendReq::_internal_mutable_name() {
+  
+  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* NotifyAuthFriendReq::release_name() {
+  // @@protoc_insertion_point(field_release:clientmsg.NotifyAuthFriendReq.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void NotifyAuthFriendReq::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.NotifyAuthFriendReq.name)
+}
+
+// string nick = 5;
+inline void NotifyAuthFriendReq::clear_nick() {
+  nick_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& NotifyAuthFriendReq::nick() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAuthFriendReq.nick)
+  return _internal_nick();
+}
+inline void NotifyAuthFriendReq::set_nick(const std::string& value) {
+  _internal_set_nick(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAuthFriendReq.nick)
+}
+inline std::string* NotifyAuthFriendReq::mutable_nick() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.NotifyAuthFriendReq.nick)
+  return _internal_mutable_nick();
+}
+inline const std::string& NotifyAuthFriendReq::_internal_nick() const {
+  return nick_.Get();
+}
+inline void NotifyAuthFriendReq::_internal_set_nick(const std::string& value) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void NotifyAuthFriendReq::set_nick(std::string&& value) {
+  
+  nick_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.NotifyAuthFriendReq.nick)
+}
+inline void NotifyAuthFriendReq::set_nick(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.NotifyAuthFriendReq.nick)
+}
+inline void NotifyAuthFriendReq::set_nick(const char* value,
+    size_t size) {
+  
+  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.NotifyAuthFriendReq.nick)
+}
+inline std::string* NotifyAuthFriendReq::_internal_mutable_nick() {
+  
+  return nick_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* NotifyAuthFriendReq::release_nick() {
+  // @@protoc_insertion_point(field_release:clientmsg.NotifyAuthFriendReq.nick)
+  return nick_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void NotifyAuthFriendReq::set_allocated_nick(std::string* nick) {
+  if (nick != nullptr) {
+    
+  } else {
+    
+  }
+  nick_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nick,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.NotifyAuthFriendReq.nick)
+}
+
+// string icon = 6;
+inline void NotifyAuthFriendReq::clear_icon() {
+  icon_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& NotifyAuthFriendReq::icon() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAuthFriendReq.icon)
+  return _internal_icon();
+}
+inline void NotifyAuthFriendReq::set_icon(const std::string& value) {
+  _internal_set_icon(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAuthFriendReq.icon)
+}
+inline std::string* NotifyAuthFriendReq::mutable_icon() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.NotifyAuthFriendReq.icon)
+  return _internal_mutable_icon();
+}
+inline const std::string& NotifyAuthFriendReq::_internal_icon() const {
+  return icon_.Get();
+}
+inline void NotifyAuthFriendReq::_internal_set_icon(const std::string& value) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void NotifyAuthFriendReq::set_icon(std::string&& value) {
+  
+  icon_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.NotifyAuthFriendReq.icon)
+}
+inline void NotifyAuthFriendReq::set_icon(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.NotifyAuthFriendReq.icon)
+}
+inline void NotifyAuthFriendReq::set_icon(const char* value,
+    size_t size) {
+  
+  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.NotifyAuthFriendReq.icon)
+}
+inline std::string* NotifyAuthFriendReq::_internal_mutable_icon() {
+  
+  return icon_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* NotifyAuthFriendReq::release_icon() {
+  // @@protoc_insertion_point(field_release:clientmsg.NotifyAuthFriendReq.icon)
+  return icon_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void NotifyAuthFriendReq::set_allocated_icon(std::string* icon) {
+  if (icon != nullptr) {
+    
+  } else {
+    
+  }
+  icon_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), icon,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.NotifyAuthFriendReq.icon)
+}
+
+// int32 sex = 7;
+inline void NotifyAuthFriendReq::clear_sex() {
+  sex_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAuthFriendReq::_internal_sex() const {
+  return sex_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 NotifyAuthFriendReq::sex() const {
+  // @@protoc_insertion_point(field_get:clientmsg.NotifyAuthFriendReq.sex)
+  return _internal_sex();
+}
+inline void NotifyAuthFriendReq::_internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  sex_ = value;
+}
+inline void NotifyAuthFriendReq::set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_sex(value);
+  // @@protoc_insertion_point(field_set:clientmsg.NotifyAuthFriendReq.sex)
+}
+
+// -------------------------------------------------------------------
+
+// TextChatItem
+
+// string msgid = 1;
+inline void TextChatItem::clear_msgid() {
+  msgid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& TextChatItem::msgid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.TextChatItem.msgid)
+  return _internal_msgid();
+}
+inline void TextChatItem::set_msgid(const std::string& value) {
+  _internal_set_msgid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.TextChatItem.msgid)
+}
+inline std::string* TextChatItem::mutable_msgid() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.TextChatItem.msgid)
+  return _internal_mutable_msgid();
+}
+inline const std::string& TextChatItem::_internal_msgid() const {
+  return msgid_.Get();
+}
+inline void TextChatItem::_internal_set_msgid(const std::string& value) {
+  
+  msgid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TextChatItem::set_msgid(std::string&& value) {
+  
+  msgid_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.TextChatItem.msgid)
+}
+inline void TextChatItem::set_msgid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  msgid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.TextChatItem.msgid)
+}
+inline void TextChatItem::set_msgid(const char* value,
+    size_t size) {
+  
+  msgid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.TextChatItem.msgid)
+}
+inline std::string* TextChatItem::_internal_mutable_msgid() {
+  
+  return msgid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TextChatItem::release_msgid() {
+  // @@protoc_insertion_point(field_release:clientmsg.TextChatItem.msgid)
+  return msgid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TextChatItem::set_allocated_msgid(std::string* msgid) {
+  if (msgid != nullptr) {
+    
+  } else {
+    
+  }
+  msgid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), msgid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.TextChatItem.msgid)
+}
+
+// string content = 2;
+inline void TextChatItem::clear_content() {
+  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& TextChatItem::content() const {
+  // @@protoc_insertion_point(field_get:clientmsg.TextChatItem.content)
+  return _internal_content();
+}
+inline void TextChatItem::set_content(const std::string& value) {
+  _internal_set_content(value);
+  // @@protoc_insertion_point(field_set:clientmsg.TextChatItem.content)
+}
+inline std::string* TextChatItem::mutable_content() {
+  // @@protoc_insertion_point(field_mutable:clientmsg.TextChatItem.content)
+  return _internal_mutable_content();
+}
+inline const std::string& TextChatItem::_internal_content() const {
+  return content_.Get();
+}
+inline void TextChatItem::_internal_set_content(const std::string& value) {
+  
+  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TextChatItem::set_content(std::string&& value) {
+  
+  content_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:clientmsg.TextChatItem.content)
+}
+inline void TextChatItem::set_content(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:clientmsg.TextChatItem.content)
+}
+inline void TextChatItem::set_content(const char* value,
+    size_t size) {
+  
+  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:clientmsg.TextChatItem.content)
+}
+inline std::string* TextChatItem::_internal_mutable_content() {
+  
+  return content_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TextChatItem::release_content() {
+  // @@protoc_insertion_point(field_release:clientmsg.TextChatItem.content)
+  return content_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TextChatItem::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  content_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), content,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:clientmsg.TextChatItem.content)
+}
+
+// -------------------------------------------------------------------
+
+// TextChatReq
+
+// int32 fromuid = 1;
+inline void TextChatReq::clear_fromuid() {
+  fromuid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatReq::_internal_fromuid() const {
+  return fromuid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatReq::fromuid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.TextChatReq.fromuid)
+  return _internal_fromuid();
+}
+inline void TextChatReq::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  fromuid_ = value;
+}
+inline void TextChatReq::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_fromuid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.TextChatReq.fromuid)
+}
+
+// int32 touid = 2;
+inline void TextChatReq::clear_touid() {
+  touid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatReq::_internal_touid() const {
+  return touid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatReq::touid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.TextChatReq.touid)
+  return _internal_touid();
+}
+inline void TextChatReq::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  touid_ = value;
+}
+inline void TextChatReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_touid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.TextChatReq.touid)
+}
+
+// repeated .clientmsg.TextChatItem text_array = 3;
+inline int TextChatReq::_internal_text_array_size() const {
+  return text_array_.size();
+}
+inline int TextChatReq::text_array_size() const {
+  return _internal_text_array_size();
+}
+inline void TextChatReq::clear_text_array() {
+  text_array_.Clear();
+}
+inline ::clientmsg::TextChatItem* TextChatReq::mutable_text_array(int index) {
+  // @@protoc_insertion_point(field_mutable:clientmsg.TextChatReq.text_array)
+  return text_array_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem >*
+TextChatReq::mutable_text_array() {
+  // @@protoc_insertion_point(field_mutable_list:clientmsg.TextChatReq.text_array)
+  return &text_array_;
+}
+inline const ::clientmsg::TextChatItem& TextChatReq::_internal_text_array(int index) const {
+  return text_array_.Get(index);
+}
+inline const ::clientmsg::TextChatItem& TextChatReq::text_array(int index) const {
+  // @@protoc_insertion_point(field_get:clientmsg.TextChatReq.text_array)
+  return _internal_text_array(index);
+}
+inline ::clientmsg::TextChatItem* TextChatReq::_internal_add_text_array() {
+  return text_array_.Add();
+}
+inline ::clientmsg::TextChatItem* TextChatReq::add_text_array() {
+  // @@protoc_insertion_point(field_add:clientmsg.TextChatReq.text_array)
+  return _internal_add_text_array();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem >&
+TextChatReq::text_array() const {
+  // @@protoc_insertion_point(field_list:clientmsg.TextChatReq.text_array)
+  return text_array_;
+}
+
+// -------------------------------------------------------------------
+
+// TextChatRsp
+
+// int32 error = 1;
+inline void TextChatRsp::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatRsp::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatRsp::error() const {
+  // @@protoc_insertion_point(field_get:clientmsg.TextChatRsp.error)
+  return _internal_error();
+}
+inline void TextChatRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void TextChatRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:clientmsg.TextChatRsp.error)
+}
+
+// int32 fromuid = 2;
+inline void TextChatRsp::clear_fromuid() {
+  fromuid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatRsp::_internal_fromuid() const {
+  return fromuid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatRsp::fromuid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.TextChatRsp.fromuid)
+  return _internal_fromuid();
+}
+inline void TextChatRsp::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  fromuid_ = value;
+}
+inline void TextChatRsp::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_fromuid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.TextChatRsp.fromuid)
+}
+
+// int32 touid = 3;
+inline void TextChatRsp::clear_touid() {
+  touid_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatRsp::_internal_touid() const {
+  return touid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatRsp::touid() const {
+  // @@protoc_insertion_point(field_get:clientmsg.TextChatRsp.touid)
+  return _internal_touid();
+}
+inline void TextChatRsp::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  touid_ = value;
+}
+inline void TextChatRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_touid(value);
+  // @@protoc_insertion_point(field_set:clientmsg.TextChatRsp.touid)
+}
+
+// repeated .clientmsg.TextChatItem text_array = 4;
+inline int TextChatRsp::_internal_text_array_size() const {
+  return text_array_.size();
+}
+inline int TextChatRsp::text_array_size() const {
+  return _internal_text_array_size();
+}
+inline void TextChatRsp::clear_text_array() {
+  text_array_.Clear();
+}
+inline ::clientmsg::TextChatItem* TextChatRsp::mutable_text_array(int index) {
+  // @@protoc_insertion_point(field_mutable:clientmsg.TextChatRsp.text_array)
+  return text_array_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem >*
+TextChatRsp::mutable_text_array() {
+  // @@protoc_insertion_point(field_mutable_list:clientmsg.TextChatRsp.text_array)
+  return &text_array_;
+}
+inline const ::clientmsg::TextChatItem& TextChatRsp::_internal_text_array(int index) const {
+  return text_array_.Get(index);
+}
+inline const ::clientmsg::TextChatItem& TextChatRsp::text_array(int index) const {
+  // @@protoc_insertion_point(field_get:clientmsg.TextChatRsp.text_array)
+  return _internal_text_array(index);
+}
+inline ::clientmsg::TextChatItem* TextChatRsp::_internal_add_text_array() {
+  return text_array_.Add();
+}
+inline ::clientmsg::TextChatItem* TextChatRsp::add_text_array() {
+  // @@protoc_insertion_point(field_add:clientmsg.TextChatRsp.text_array)
+  return _internal_add_text_array();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::clientmsg::TextChatItem >&
+TextChatRsp::text_array() const {
+  // @@protoc_insertion_point(field_list:clientmsg.TextChatRsp.text_array)
+  return text_array_;
+}
+
+// -------------------------------------------------------------------
+
+// HeartBeatRsp
+
+// int32 error = 1;
+inline void HeartBeatRsp::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 HeartBeatRsp::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 HeartBeatRsp::error() const {
+  // @@protoc_insertion_point(field_get:clientmsg.HeartBeatRsp.error)
+  return _internal_error();
+}
+inline void HeartBeatRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void HeartBeatRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:clientmsg.HeartBeatRsp.error)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace clientmsg
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_clientmsg_2eproto
@@ -14,9 +14,6 @@
 #include <boost/filesystem.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/ini_parser.hpp>
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
 
 namespace beast = boost::beast;         // from <boost/beast.hpp>
 namespace http = beast::http;           // from <boost/beast/http.hpp>
@@ -64,8 +61,75 @@ private:
 #define HEAD_ID_LEN 2
 //ͷݳ
 #define HEAD_DATA_LEN 2
+//չͷ: id(λ1, 2ֽ) | ־(2ֽ) | ݳ(4ֽ)
+#define HEAD_EXT_TOTAL_LEN 8
+#define HEAD_FLAG_LEN 2
+#define HEAD_EXT_DATA_LEN 4
+#define HEAD_EXT_MASK 0x8000
+//־λ: 滹зƬһƬƴһϢ
+//ͬһʱֻƴһƬϢյid֡ճͬid֡ΪϢĺƬ
+#define MSG_FLAG_MORE 0x0001
+//־λ: Ϣ徭deflateѹ
+#define MSG_FLAG_COMPRESS 0x0002
+//ĬϳóȵϢѹ
+#define COMPRESS_THRESHOLD 512
+//ͷ2ֽڳܱʾϢ
+#define MAX_LEGACY_LEN 0x7FFF
+//չͷƬ󳤶ȺͷƬƴӺϢ󳤶
+#define MAX_FRAME_LEN 1024*1024
+#define MAX_MSG_LEN 1024*1024*4
+//ỰջСһζȡȡϢ
+#define RECV_BUFFER_LEN 1024*16
+//ڴÿ߳ÿ໺Ŀп
+#define MSG_POOL_CACHE_COUNT 256
+//̻߳ȫת֮ÿΰ˵Ŀ
+#define MSG_POOL_BATCH_COUNT 64
 #define MAX_RECVQUE 10000
-#define MAX_SENDQUE 1000
+//߼߳ÿδӶȡϢ
+#define LOGIC_BATCH_SIZE 64
+//ͶĬϵĸߵˮλ(ֽ)ˮλѲԴֱ䵽ˮλ
+#define SEND_HIGH_WATER 1024*1024
+#define SEND_LOW_WATER 1024*256
+//һasync_writeϲ͵Ϣֽ
+#define MAX_SEND_BATCH 64
+#define MAX_SEND_BATCH_LEN 1024*64
+//ỰĬϵʱʱ()ʱδյκݵĻỰر
+#define HEARTBEAT_TIMEOUT 60
+//ذ
+#define HEARTBEAT_RSP_DATA "{\"error\":0}"
+//Ựķֶ
+#define SESSION_SHARD_NUM 64
+//ûϢػķֶĬĬϹʱ()
+#define USER_CACHE_SHARD_NUM 16
+#define USER_CACHE_CAPACITY 100000
+#define USER_CACHE_TTL 60
+//ڵuidĬϻʱ()
+#define USER_CACHE_NEGATIVE_TTL 5
+//ÿֶʧЧ汾ŵĲuidλ汾
+#define USER_CACHE_VERSION_SLOTS 256
+//ʱÿһĲ
+#define TIMER_WHEEL_SLOTS 64
+
+//ͻЭ飬¼ʱͨcodecֶЭ
+enum MsgCodecType {
+	CODEC_JSON = 0,
+	CODEC_PROTOBUF = 1,
+};
+
+//Ự߼״̬
+enum LoginState {
+	LOGIN_STATE_NONE = 0,
+	LOGIN_STATE_ONLINE = 1,
+	LOGIN_STATE_CLOSED = 2,
+};
+
+//ͶгˮλʱĴ
+enum SendSlowPolicy {
+	SLOW_DROP_OLDEST = 0,  //δϢ
+	SLOW_COALESCE = 1,     //滻͵Ϣ滻ͬ͵δϢͶϢ
+	SLOW_DISCONNECT = 2,   //Ͽ
+	SLOW_SPILL = 3,        //Ϣת浽redis߶
+};
 
 enum MSG_IDS {
 	MSG_CHAT_LOGIN = 1005,//û¼
@@ -95,6 +159,14 @@ enum MSG_IDS {
 #define LOCK_PREFIX "lock_"
 #define USER_SESSION_PREFIX "usession_"
 #define LOCK_COUNT "lockcount"
+#define STATS_PREFIX "chatstats_"
+#define OFFLINE_MSG_PREFIX "offmsg_"
+//߶Ĭϱʹʱ()
+#define OFFLINE_MSG_MAX_LEN 1000
+#define OFFLINE_MSG_TTL 7*24*3600
+//Ựʱÿδ߶ȡ·͵
+#define SPILL_REPLAY_BATCH 100
+#define BUS_CHANNEL_PREFIX "chatbus_"
 
 //ֲʽĳʱ
 #define LOCK_TIME_OUT 10
@@ -9,4 +9,7 @@ echo Generating gRPC code...
 echo Generating C++ code...
 %PROTOC_PATH% --cpp_out=. "%PROTO_FILE%"
 
+echo Generating client message code...
+%PROTOC_PATH% --cpp_out=. clientmsg.proto
+
 echo Done.
\ No newline at end of file
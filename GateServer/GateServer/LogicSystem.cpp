@@ -4,6 +4,7 @@
 #include "RedisMgr.h"
 #include "MysqlMgr.h"
 #include "StatusGrpcClient.h"
+#include "JsonWriter.h"
 bool LogicSystem::HandleGet(std::string path, std::shared_ptr<HttpConnection> con)
 {
 	if (_get_handlers.find(path) == _get_handlers.end()) {
@@ -53,7 +54,7 @@ LogicSystem::LogicSystem() {
 		if (!parse_success) {
 			std::cout << "Failed to parse JSON data!" << std::endl;
 			root["error"] = ErrorCodes::Error_Json;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -62,7 +63,7 @@ LogicSystem::LogicSystem() {
 		std::cout << "email is " << email << std::endl;
 		root["error"] = rsp.error();
 		root["email"] = src_root["email"];
-		std::string jsonstr = root.toStyledString();
+		std::string jsonstr = JsonWriter::Write(root);
 		beast::ostream(connection->_response.body()) << jsonstr;
 		return true;
 		});
@@ -78,7 +79,7 @@ LogicSystem::LogicSystem() {
 		if (!parse_success) {
 			std::cout << "Failed to parse JSON data!" << std::endl;
 			root["error"] = ErrorCodes::Error_Json;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -92,7 +93,7 @@ LogicSystem::LogicSystem() {
 		{
 			std::cout << "password err" << std::endl;
 			root["error"] = ErrorCodes::passwdErr;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -103,14 +104,14 @@ LogicSystem::LogicSystem() {
 		if (!b_get_varify) {
 			std::cout << "get varify code expired" << std::endl;
 			root["error"] = ErrorCodes::VarifyExpired;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
 		if (varify_code != src_root["varifycode"].asString()) {
 			std::cout << "varify code error" << std::endl;
 			root["error"] = ErrorCodes::VarifyCodeErr;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -120,7 +121,7 @@ LogicSystem::LogicSystem() {
 		if (b_usr_exist) {
 			std::cout << " user exist" << std::endl;
 			root["error"] = ErrorCodes::UserExist;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -130,7 +131,7 @@ LogicSystem::LogicSystem() {
 		{
 			std::cout << "user or email exist" << std::endl;
 			root["error"] = ErrorCodes::UserExist;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -141,7 +142,7 @@ LogicSystem::LogicSystem() {
 		root["passwd"] = pwd;
 		root["confirm"] = confirm;
 		root["varifycode"] = src_root["varifycode"].asString();
-		std::string jsonstr = root.toStyledString();
+		std::string jsonstr = JsonWriter::Write(root);
 		beast::ostream(connection->_response.body()) << jsonstr;
 		return true;
 		});
@@ -158,7 +159,7 @@ LogicSystem::LogicSystem() {
 		if (!parse_success) {
 			std::cout << "Failed to parse JSON data!" << std::endl;
 			root["error"] = ErrorCodes::Error_Json;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -171,14 +172,14 @@ LogicSystem::LogicSystem() {
 		if (!b_get_varify) {
 			std::cout << " get varify code expired" << std::endl;
 			root["error"] = ErrorCodes::VarifyExpired;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
 		if (varify_code != src_root["varifycode"].asString()) {
 			std::cout << " varify code error" << std::endl;
 			root["error"] = ErrorCodes::VarifyCodeErr;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -187,7 +188,7 @@ LogicSystem::LogicSystem() {
 		if (!email_valid) {
 			std::cout << " user email not match" << std::endl;
 			root["error"] = ErrorCodes::EmailNotMatch;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -196,7 +197,7 @@ LogicSystem::LogicSystem() {
 		if (!b_up) {
 			std::cout << " update pwd failed" << std::endl;
 			root["error"] = ErrorCodes::PasswdUpFailed;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -206,7 +207,7 @@ LogicSystem::LogicSystem() {
 		root["user"] = name;
 		root["passwd"] = pwd;
 		root["varifycode"] = src_root["varifycode"].asString();
-		std::string jsonstr = root.toStyledString();
+		std::string jsonstr = JsonWriter::Write(root);
 		beast::ostream(connection->_response.body()) << jsonstr;
 		return true;
 		});
@@ -223,7 +224,7 @@ LogicSystem::LogicSystem() {
 		if (!parse_success) {
 			std::cout << "Failed to parse JSON data!" << std::endl;
 			root["error"] = ErrorCodes::Error_Json;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -235,7 +236,7 @@ LogicSystem::LogicSystem() {
 		if (!pwd_valid) {
 			std::cout << " email pwd not match" << std::endl;
 			root["error"] = ErrorCodes::PasswdInvalid;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -244,7 +245,7 @@ LogicSystem::LogicSystem() {
 		if (reply.error()) {
 			std::cout << " grpc get chat server failed, error is " << reply.error() << std::endl;
 			root["error"] = ErrorCodes::RPCFailed;
-			std::string jsonstr = root.toStyledString();
+			std::string jsonstr = JsonWriter::Write(root);
 			beast::ostream(connection->_response.body()) << jsonstr;
 			return true;
 		}
@@ -255,7 +256,7 @@ LogicSystem::LogicSystem() {
 		root["token"] = reply.token();
 		root["host"] = reply.host();
 		root["port"] = reply.port();
-		std::string jsonstr = root.toStyledString();
+		std::string jsonstr = JsonWriter::Write(root);
 		beast::ostream(connection->_response.body()) << jsonstr;
 		return true;
 		});